@@ -41,18 +41,13 @@
  * déclaration ici.
 /*/
 int get_max_etat( const Automate* automate );
-
-void action_get_min_etat( const intptr_t element, void* data ){
-	int * min = (int*) data;
-	if( *min > element ) *min = element;
-}
+void ajouter_lettres( Automate * automate, const Ensemble * alphabet );
+int enregistrer_etat( Automate * automate, int etat );
+void ecrire_composante( Automate * automate, enum Composante composante );
+void lacher_composante( Automate * automate, enum Composante composante );
 
 int get_min_etat( const Automate* automate ){
-	int min = INT_MAX;
-
-	pour_tout_element( automate->etats, action_get_min_etat, &min );
-
-	return min;
+	return automate->min_etat;
 }
 
 
@@ -78,7 +73,7 @@ void supprimer_cle( Cle* cle ){
 
 void initialiser_cle( Cle* cle, int origine, char lettre ){
 	cle->origine = origine;
-	cle->lettre = (int) lettre;
+	cle->lettre = (unsigned char) lettre;
 }
 
 Cle * creer_cle( int origine, char lettre ){
@@ -91,603 +86,3188 @@ Cle * copier_cle( const Cle* cle ){
 	return creer_cle( cle->origine, cle->lettre );
 }
 
-Automate * creer_automate(){
-	Automate * automate = xmalloc( sizeof(Automate) );
-	automate->etats = creer_ensemble( NULL, NULL, NULL );
-	automate->alphabet = creer_ensemble( NULL, NULL, NULL );
-	automate->transitions = creer_table(
+Table * creer_table_des_transitions(){
+	return creer_table(
 		( int(*)(const intptr_t, const intptr_t) ) comparer_cle , 
 		( intptr_t (*)( const intptr_t ) ) copier_cle,
 		( void(*)(intptr_t) ) supprimer_cle
 	);
-	automate->initiaux = creer_ensemble( NULL, NULL, NULL );
-	automate->finaux = creer_ensemble( NULL, NULL, NULL );
-	automate->vide = creer_ensemble( NULL, NULL, NULL ); 
-	return automate;
 }
 
-Automate * translater_automate_entier( const Automate* automate, int translation ){
-	Automate * res = creer_automate();
+/*
+ * Les clés de l'index des transitions par état d'arrivée sont des
+ * transitions, rangées par fin, lettre (comme octet non signé) puis origine :
+ * les transitions qui arrivent dans un état sont contiguës.
+ */
+int comparer_entrante( const Transition * a, const Transition * b ){
+	if( a->fin != b->fin )
+		return a->fin < b->fin ? -1 : 1;
+	if( a->lettre != b->lettre )
+		return (unsigned char) a->lettre < (unsigned char) b->lettre ? -1 : 1;
+	if( a->origine != b->origine )
+		return a->origine < b->origine ? -1 : 1;
+	return 0;
+}
 
-	Ensemble_iterateur it;
-	for( 
-		it = premier_iterateur_ensemble( get_etats( automate ) );
-		! iterateur_ensemble_est_vide( it );
-		it = iterateur_suivant_ensemble( it )
-	){
-		ajouter_etat( res, get_element( it ) + translation );
-	}
+Transition * copier_entrante( const Transition * transition ){
+	Transition * res = xmalloc( sizeof(Transition) );
+	*res = *transition;
+	return res;
+}
 
-	for( 
-		it = premier_iterateur_ensemble( get_initiaux( automate ) );
-		! iterateur_ensemble_est_vide( it );
-		it = iterateur_suivant_ensemble( it )
-	){
-		ajouter_etat_initial( res, get_element( it ) + translation );
-	}
+void supprimer_entrante( Transition * transition ){
+	xfree( transition );
+}
 
-	for( 
-		it = premier_iterateur_ensemble( get_finaux( automate ) );
-		! iterateur_ensemble_est_vide( it );
-		it = iterateur_suivant_ensemble( it )
-	){
-		ajouter_etat_final( res, get_element( it ) + translation );
-	}
+Table * creer_table_des_entrantes(){
+	return creer_table(
+		( int(*)(const intptr_t, const intptr_t) ) comparer_entrante,
+		( intptr_t (*)( const intptr_t ) ) copier_entrante,
+		( void(*)(intptr_t) ) supprimer_entrante
+	);
+}
 
-	// On ajoute les lettres
-	for(
-		it = premier_iterateur_ensemble( get_alphabet( automate ) );
-		! iterateur_ensemble_est_vide( it );
-		it = iterateur_suivant_ensemble( it )
-	){
-		ajouter_lettre( res, (char) get_element( it ) );
+/*
+ * Ajoute la transition à l'index des transitions par état d'arrivée, ou l'en
+ * retire, si l'index est tenu. La composante des transitions doit déjà être
+ * propre à l'automate.
+ */
+void indexer_entrante( Automate * automate, int origine, char lettre, int fin ){
+	if( automate->entrantes ){
+		Transition transition = { origine, lettre, fin };
+		add_table( automate->entrantes, (intptr_t) &transition, 0 );
 	}
+}
 
-	Table_iterateur it1;
-	Ensemble_iterateur it2;
-	for(
-		it1 = premier_iterateur_table( automate->transitions );
-		! iterateur_est_vide( it1 );
-		it1 = iterateur_suivant_table( it1 )
-	){
-		Cle * cle = (Cle*) get_cle( it1 );
-		Ensemble * fins = (Ensemble*) get_valeur( it1 );
-		for(
-			it2 = premier_iterateur_ensemble( fins );
-			! iterateur_ensemble_est_vide( it2 );
-			it2 = iterateur_suivant_ensemble( it2 )
-		){
-			int fin = get_element( it2 );
-			ajouter_transition(
-				res, cle->origine + translation, cle->lettre, fin + translation
-			);
-		}
-	};
-
-	return res;
+void desindexer_entrante(
+	Automate * automate, int origine, char lettre, int fin
+){
+	if( automate->entrantes ){
+		Transition transition = { origine, lettre, fin };
+		delete_table( automate->entrantes, (intptr_t) &transition );
+	}
 }
 
+/*
+ * Les ensembles d'arrivée sont partagés : les couples (origine, lettre) de
+ * mêmes états d'arrivée pointent tous vers un seul ensemble, rangé dans la
+ * table 'arrivees' avec son nombre de références. Un ensemble de cette table
+ * n'est jamais modifié, sans quoi la table ne serait plus triée ; on le
+ * reprend avec reprendre_arrivees() avant de le modifier, puis on le partage
+ * de nouveau.
+ *
+ * Les copies d'un automate peuvent partager les nœuds de 'arrivees' (voir
+ * dupliquer_composante()) : chaque nœud retient sa clé, et un ensemble n'est
+ * libéré que lorsqu'aucune copie ne l'utilise plus.
+ */
 
-void liberer_automate( Automate * automate ){
-	assert( automate );
-	liberer_ensemble( automate->vide );
-	liberer_ensemble( automate->finaux );
-	liberer_ensemble( automate->initiaux );
-	pour_toute_valeur_table(
-		automate->transitions, ( void(*)(intptr_t) ) liberer_ensemble
-	);
-	liberer_table( automate->transitions );
-	liberer_ensemble( automate->alphabet );
-	liberer_ensemble( automate->etats );
-	xfree(automate);
+/*
+ * Renvoie l'ensemble partagé de même contenu que 'ensemble', et en prend une
+ * référence. 'ensemble' devient l'ensemble partagé s'il n'y en a pas
+ * encore ; dans tous les cas, l'appelant ne le détient plus.
+ */
+Ensemble * partager_arrivees( Automate * automate, Ensemble * ensemble ){
+	Table_iterateur it = trouver_table( automate->arrivees, (intptr_t) ensemble );
+	Ensemble * partage = ensemble;
+	if( iterateur_est_vide( it ) ){
+		add_table( automate->arrivees, (intptr_t) ensemble, 1 );
+	}else{
+		set_valeur( it, get_valeur( it ) + 1 );
+		partage = (Ensemble*) get_cle( it );
+	}
+	liberer_ensemble( ensemble );
+	return partage;
 }
 
-const Ensemble * get_etats( const Automate* automate ){
-	return automate->etats;
+/*
+ * Rend une référence sur un ensemble partagé, qui est libéré quand plus
+ * aucun couple (origine, lettre) d'aucune copie ne l'utilise.
+ */
+void lacher_arrivees( Automate * automate, Ensemble * ensemble ){
+	Table_iterateur it = trouver_table( automate->arrivees, (intptr_t) ensemble );
+	assert( (Ensemble*) get_cle( it ) == ensemble );
+	if( get_valeur( it ) > 1 ){
+		set_valeur( it, get_valeur( it ) - 1 );
+	}else{
+		delete_table( automate->arrivees, (intptr_t) ensemble );
+	}
 }
 
-const Ensemble * get_initiaux( const Automate* automate ){
-	return automate->initiaux;
+/*
+ * Rend une référence sur un ensemble partagé (ou NULL) et renvoie un
+ * ensemble modifiable de même contenu. Un ensemble que plus personne
+ * n'utilise est renvoyé tel quel ; sinon, on en renvoie une copie, faite en
+ * temps constant.
+ */
+Ensemble * reprendre_arrivees( Automate * automate, Ensemble * ensemble ){
+	if( ! ensemble ){
+		return creer_ensemble( NULL, NULL, NULL );
+	}
+	retenir_ensemble( ensemble );
+	lacher_arrivees( automate, ensemble );
+	if( ensemble->references == 1 ){
+		return ensemble;
+	}
+	Ensemble * copie = copier_ensemble( ensemble );
+	liberer_ensemble( ensemble );
+	return copie;
 }
 
-const Ensemble * get_finaux( const Automate* automate ){
-	return automate->finaux;
+/*
+ * Partage l'ensemble d'arrivée modifiable 'fins' et le range dans la table
+ * des transitions pour la clé 'cle'. 'it' est le résultat de la recherche de
+ * la clé, ou NULL si on sait la clé absente.
+ */
+void ranger_arrivees(
+	Automate * automate, Table_iterateur * it, const Cle * cle, Ensemble * fins
+){
+	fins = partager_arrivees( automate, fins );
+	if( ! it || iterateur_est_vide( *it ) ){
+		add_table( automate->transitions, (intptr_t) cle, (intptr_t) fins );
+	}else{
+		set_valeur( *it, (intptr_t) fins );
+	}
 }
 
-const Ensemble * get_alphabet( const Automate* automate ){
-	return automate->alphabet;
+
+/*
+ * Les ensembles d'arrivée partagés sont rangés par empreinte : le contenu
+ * n'est comparé qu'entre ensembles de même empreinte.
+ */
+int comparer_arrivees( const Ensemble * ens1, const Ensemble * ens2 ){
+	uint64_t empreinte1 = empreinte_ensemble( ens1 );
+	uint64_t empreinte2 = empreinte_ensemble( ens2 );
+	if( empreinte1 != empreinte2 ){
+		return empreinte1 < empreinte2 ? -1 : 1;
+	}
+	return comparer_ensemble( ens1, ens2 );
 }
 
-void ajouter_etat( Automate * automate, int etat ){
-	ajouter_element( automate->etats, etat );
+Table * creer_table_des_arrivees(){
+	return creer_table(
+		( int(*)(const intptr_t, const intptr_t) ) comparer_arrivees,
+		( intptr_t (*)( const intptr_t ) ) retenir_ensemble,
+		( void(*)(intptr_t) ) liberer_ensemble
+	);
 }
 
-void ajouter_lettre( Automate * automate, char lettre ){
-	ajouter_element( automate->alphabet, lettre );
+/*
+ * Alloue le compte de partage d'une composante propre à un automate.
+ */
+atomic_int * creer_compte_de_references(){
+	atomic_int * references = xmalloc( sizeof(atomic_int) );
+	atomic_init( references, 1 );
+	return references;
 }
 
-void ajouter_transition(
-	Automate * automate, int origine, char lettre, int fin
+/*
+ * Alloue un automate dont les ensembles sont ceux passés en paramètre. Les
+ * indices des états ne sont pas enregistrés.
+ */
+Automate * allouer_automate(
+	Ensemble * etats, Ensemble * alphabet, Ensemble * initiaux, Ensemble * finaux
 ){
-	ajouter_etat( automate, origine );
-	ajouter_etat( automate, fin );
-	ajouter_lettre( automate, lettre );
-	
-	Cle cle;
-	initialiser_cle( &cle, origine, lettre );
-	Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
-	Ensemble * ens;
-	if( iterateur_est_vide( it ) ){
-		ens = creer_ensemble( NULL, NULL, NULL );
-		add_table( automate->transitions, (intptr_t) &cle, (intptr_t) ens );
-	}else{
-		ens = (Ensemble*) get_valeur( it );
+	Automate * automate = xmalloc( sizeof(Automate) );
+	automate->etats = etats;
+	automate->alphabet = alphabet;
+	automate->transitions = creer_table_des_transitions();
+	automate->entrantes = NULL;
+	automate->arrivees = creer_table_des_arrivees();
+	automate->initiaux = initiaux;
+	automate->finaux = finaux;
+	automate->vide = creer_ensemble( NULL, NULL, NULL ); 
+	automate->puits = NULL;
+	automate->co_accessibles = NULL;
+	int i;
+	for( i=0; i<4; i++ ) automate->lettres[i] = 0;
+	automate->indices = creer_table( NULL, NULL, NULL );
+	automate->etats_par_indice = NULL;
+	automate->capacite_indices = 0;
+	automate->indices_directs = NULL;
+	automate->base_indices = 0;
+	automate->taille_indices_directs = 0;
+	automate->min_etat = INT_MAX;
+	automate->max_etat = INT_MIN;
+	for( i=0; i<NB_COMPOSANTES; i++ ){
+		automate->references[i] = creer_compte_de_references();
 	}
-	ajouter_element( ens, fin );
+	return automate;
 }
 
-void ajouter_etat_final(
-	Automate * automate, int etat_final
-){
-	ajouter_etat( automate, etat_final );
-	ajouter_element( automate->finaux, etat_final );
+/*/
+ * Les indices denses sont aussi rangés dans un tableau direct, indexé par
+ * état - base_indices, tant que l'étendue des états reste de l'ordre de leur
+ * nombre n. Le tableau est abandonné quand l'étendue dépasse 4n + 64, et
+ * n'est reconstruit que quand elle redescend sous 2n + 64 : entre les deux,
+ * n a au moins doublé, ce qui amortit les reconstructions.
+/*/
+long long etendue_des_etats( const Automate * automate ){
+	if( automate->min_etat > automate->max_etat ){
+		return 0;
+	}
+	return (long long) automate->max_etat - automate->min_etat + 1;
 }
 
-void ajouter_etat_initial(
-	Automate * automate, int etat_initial
-){
-	ajouter_etat( automate, etat_initial );
-	ajouter_element( automate->initiaux, etat_initial );
+void reconstruire_indices_directs( Automate * automate ){
+	int n = taille_ensemble( automate->etats );
+	long long etendue = etendue_des_etats( automate );
+	// Une marge de chaque côté évite de reconstruire à chaque nouvel état.
+	long long base = (long long) automate->min_etat - etendue / 2 - 8;
+	long long fin = (long long) automate->max_etat + etendue + 8;
+	if( base < INT_MIN ) base = INT_MIN;
+	if( fin > INT_MAX ) fin = INT_MAX;
+	int i;
+
+	xfree( automate->indices_directs );
+	automate->base_indices = (int) base;
+	automate->taille_indices_directs = (int) ( fin - base + 1 );
+	automate->indices_directs = xmalloc(
+		automate->taille_indices_directs * sizeof(int)
+	);
+	for( i=0; i<automate->taille_indices_directs; i++ ){
+		automate->indices_directs[i] = -1;
+	}
+	for( i=0; i<n; i++ ){
+		int etat = automate->etats_par_indice[i];
+		automate->indices_directs[ etat - automate->base_indices ] = i;
+	}
 }
 
-const Ensemble * voisins( const Automate* automate, int origine, char lettre ){
-	Cle cle;
-	initialiser_cle( &cle, origine, lettre );
-	Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
-	if( ! iterateur_est_vide( it ) ){
-		return (Ensemble*) get_valeur( it );
+/*
+ * Range l'indice d'un état dans le tableau direct, après la mise à jour des
+ * états et de leurs extrêmes.
+ */
+void placer_indice_direct( Automate * automate, int etat, int indice ){
+	long long n = taille_ensemble( automate->etats );
+	long long etendue = etendue_des_etats( automate );
+	if( ! automate->indices_directs ){
+		if( n > 0 && etendue <= 2 * n + 64 ){
+			reconstruire_indices_directs( automate );
+		}
+		return;
+	}
+	long long place = (long long) etat - automate->base_indices;
+	if( etendue > 4 * n + 64 ){
+		xfree( automate->indices_directs );
+		automate->indices_directs = NULL;
+	}else if( place >= 0 && place < automate->taille_indices_directs ){
+		automate->indices_directs[ place ] = indice;
 	}else{
-		return automate->vide;
+		reconstruire_indices_directs( automate );
 	}
 }
 
-Ensemble * delta1(
-	const Automate* automate, int origine, char lettre
-){
-	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
-	ajouter_elements( res, voisins( automate, origine, lettre ) );
-	return res; 
+Automate * creer_automate(){
+	return allouer_automate(
+		creer_ensemble( NULL, NULL, NULL ), creer_ensemble( NULL, NULL, NULL ),
+		creer_ensemble( NULL, NULL, NULL ), creer_ensemble( NULL, NULL, NULL )
+	);
 }
 
-Ensemble * delta(
-	const Automate* automate, const Ensemble * etats_courants, char lettre
-){
-	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+int comparer_transitions( const void * a, const void * b ){
+	const Transition * t1 = (const Transition *) a;
+	const Transition * t2 = (const Transition *) b;
+	if( t1->origine != t2->origine ) return t1->origine < t2->origine ? -1 : 1;
+	unsigned char l1 = t1->lettre, l2 = t2->lettre;
+	if( l1 != l2 ) return l1 < l2 ? -1 : 1;
+	if( t1->fin != t2->fin ) return t1->fin < t2->fin ? -1 : 1;
+	return 0;
+}
+
+int comparer_entiers( const void * a, const void * b ){
+	int x = *(const int *) a, y = *(const int *) b;
+	return x < y ? -1 : ( x > y );
+}
+
+/*
+ * Ne garde, au début du tableau trié sans doublon 'tries', que les éléments
+ * absents de 'ensemble' et renvoie leur nombre. Les deux suites étant triées,
+ * on les parcourt ensemble : aucune recherche n'est faite.
+ */
+int garder_absents( const Ensemble * ensemble, int * tries, int nb ){
+	int i = 0, nb_absents = 0;
+	Ensemble_iterateur it = premier_iterateur_ensemble( ensemble );
+	while( i < nb ){
+		if( iterateur_ensemble_est_vide( it ) || tries[i] < get_element( it ) ){
+			tries[ nb_absents++ ] = tries[ i++ ];
+		}else if( tries[i] == get_element( it ) ){
+			i++;
+		}else{
+			it = iterateur_suivant_ensemble( it );
+		}
+	}
+	return nb_absents;
+}
 
+/*
+ * Ajoute les éléments de l'ensemble, s'il n'est pas NULL, à partir de la
+ * case 'k' du tableau, et renvoie la première case libre.
+ */
+int recopier_ensemble( const Ensemble * ensemble, int * tableau, int k ){
+	if( ! ensemble ) return k;
 	Ensemble_iterateur it;
-	for( 
-		it = premier_iterateur_ensemble( etats_courants );
+	for(
+		it = premier_iterateur_ensemble( ensemble );
 		! iterateur_ensemble_est_vide( it );
 		it = iterateur_suivant_ensemble( it )
 	){
-		const Ensemble * fins = voisins(
-			automate, get_element( it ), lettre
-		);
-		ajouter_elements( res, fins );
+		tableau[ k++ ] = get_element( it );
 	}
-
-	return res;
+	return k;
 }
 
-Ensemble * delta_star(
-	const Automate* automate, const Ensemble * etats_courants, const char* mot
+/*
+ * Renvoie le tableau trié sans doublon des origines et des fins des
+ * transitions, et des éléments de 'initiaux' et 'finaux' (qui peuvent être
+ * NULL) ; sa taille est rangée dans 'nb'. Le tableau est à libérer.
+ */
+int * extremites_des_transitions(
+	const Transition * transitions, int nb_transitions,
+	const Ensemble * initiaux, const Ensemble * finaux, int * nb
 ){
-	int len = strlen( mot );
-	int i;
-	Ensemble * old = copier_ensemble( etats_courants );
-	Ensemble * new = old;
-	for( i=0; i<len; i++ ){
-		new = delta( automate, old, *(mot+i) );
-		liberer_ensemble( old );
-		old = new;
+	int taille = 2 * nb_transitions
+		+ ( initiaux ? taille_ensemble( initiaux ) : 0 )
+		+ ( finaux ? taille_ensemble( finaux ) : 0 );
+	int * extremites = xmalloc( ( taille + 1 ) * sizeof(int) );
+	int i, k = 0;
+	for( i=0; i<nb_transitions; i++ ){
+		extremites[ k++ ] = transitions[i].origine;
+		extremites[ k++ ] = transitions[i].fin;
 	}
-	return new;
+	k = recopier_ensemble( initiaux, extremites, k );
+	k = recopier_ensemble( finaux, extremites, k );
+	qsort( extremites, k, sizeof(int), comparer_entiers );
+	*nb = 0;
+	for( i=0; i<k; i++ ){
+		if( *nb == 0 || extremites[ *nb - 1 ] != extremites[i] ){
+			extremites[ (*nb)++ ] = extremites[i];
+		}
+	}
+	return extremites;
 }
 
-void pour_toute_transition(
-	const Automate* automate,
-	void (* action )( int origine, char lettre, int fin, void* data ),
-	void* data
+/*
+ * Ajoute les lettres et les transitions du tableau à l'automate, dont les
+ * états sont déjà enregistrés. Le tableau est trié puis parcouru une seule
+ * fois : chaque couple (origine, lettre) coûte une recherche dans la table,
+ * évitée quand 'table_vide' indique qu'il n'y a rien à trouver.
+ */
+void ranger_transitions(
+	Automate * automate, Transition * transitions, int nb_transitions,
+	int table_vide
 ){
-	Table_iterateur it1;
-	Ensemble_iterateur it2;
-	for(
-		it1 = premier_iterateur_table( automate->transitions );
-		! iterateur_est_vide( it1 );
-		it1 = iterateur_suivant_table( it1 )
-	){
-		Cle * cle = (Cle*) get_cle( it1 );
-		Ensemble * fins = (Ensemble*) get_valeur( it1 );
+	ecrire_composante( automate, COMPOSANTE_ALPHABET );
+	ecrire_composante( automate, COMPOSANTE_TRANSITIONS );
+	int i;
+	for( i=0; i<nb_transitions; i++ ){
+		unsigned char octet = transitions[i].lettre;
+		if( ! ( ( automate->lettres[ octet / 64 ] >> ( octet % 64 ) ) & 1 ) ){
+			automate->lettres[ octet / 64 ] |= (uint64_t) 1 << ( octet % 64 );
+			ajouter_element( automate->alphabet, octet );
+		}
+	}
+
+	if( nb_transitions > 0 ){
+		qsort( transitions, nb_transitions, sizeof(Transition), comparer_transitions );
+	}
+	for( i=0; i<nb_transitions; ){
+		Cle cle;
+		initialiser_cle( &cle, transitions[i].origine, transitions[i].lettre );
+		Table_iterateur it;
+		Ensemble * fins = NULL;
+		if( ! table_vide ){
+			it = trouver_table( automate->transitions, (intptr_t) &cle );
+			if( ! iterateur_est_vide( it ) ){
+				fins = (Ensemble*) get_valeur( it );
+			}
+		}
+		fins = reprendre_arrivees( automate, fins );
+		int j = i;
 		for(
-			it2 = premier_iterateur_ensemble( fins );
-			! iterateur_ensemble_est_vide( it2 );
-			it2 = iterateur_suivant_ensemble( it2 )
+			;
+			j < nb_transitions
+			&& transitions[j].origine == transitions[i].origine
+			&& transitions[j].lettre == transitions[i].lettre;
+			j++
 		){
-			int fin = get_element( it2 );
-			action( cle->origine, cle->lettre, fin, data );
+			if( j == i || transitions[j].fin != transitions[j-1].fin ){
+				int taille = taille_ensemble( fins );
+				ajouter_element( fins, transitions[j].fin );
+				if( taille_ensemble( fins ) != taille ){
+					indexer_entrante(
+						automate, transitions[j].origine, transitions[j].lettre,
+						transitions[j].fin
+					);
+				}
+			}
 		}
-	};
+		ranger_arrivees( automate, table_vide ? NULL : &it, &cle, fins );
+		i = j;
+	}
 }
 
-Automate* copier_automate( const Automate* automate ){
-	Automate * res = creer_automate();
-	Ensemble_iterateur it1;
-	// On ajoute les états de l'automate
-	for(
-		it1 = premier_iterateur_ensemble( get_etats( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		ajouter_etat( res, get_element( it1 ) );
+Automate * creer_automate_a_partir_de(
+	Ensemble * etats, Ensemble * alphabet,
+	Ensemble * initiaux, Ensemble * finaux,
+	Transition * transitions, int nb_transitions
+){
+	if( ! etats ) etats = creer_ensemble( NULL, NULL, NULL );
+	if( ! alphabet ) alphabet = creer_ensemble( NULL, NULL, NULL );
+	if( ! initiaux ) initiaux = creer_ensemble( NULL, NULL, NULL );
+	if( ! finaux ) finaux = creer_ensemble( NULL, NULL, NULL );
+	Automate * automate = allouer_automate( etats, alphabet, initiaux, finaux );
+	int i;
+
+	// Les états qui manquent : extrémités des transitions, initiaux, finaux.
+	int nb;
+	int * extremites = extremites_des_transitions(
+		transitions, nb_transitions, initiaux, finaux, &nb
+	);
+	nb = garder_absents( etats, extremites, nb );
+	for( i=0; i<nb; i++ ){
+		ajouter_element( etats, extremites[i] );
 	}
-	// On ajoute les états initiaux
+	xfree( extremites );
+
+	// Les indices des états, dans l'ordre croissant.
+	automate->capacite_indices = taille_ensemble( etats );
+	automate->etats_par_indice = xmalloc(
+		( automate->capacite_indices + 1 ) * sizeof(int)
+	);
+	Ensemble_iterateur it;
 	for(
-		it1 = premier_iterateur_ensemble( get_initiaux( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
+		i = 0, it = premier_iterateur_ensemble( etats );
+		! iterateur_ensemble_est_vide( it );
+		i++, it = iterateur_suivant_ensemble( it )
 	){
-		ajouter_etat_initial( res, get_element( it1 ) );
+		int etat = get_element( it );
+		automate->etats_par_indice[i] = etat;
+		add_table( automate->indices, etat, i );
+		if( etat < automate->min_etat ) automate->min_etat = etat;
+		if( etat > automate->max_etat ) automate->max_etat = etat;
 	}
-	// On ajoute les états finaux
-	for(
-		it1 = premier_iterateur_ensemble( get_finaux( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		ajouter_etat_final( res, get_element( it1 ) );
+	if( i > 0 && etendue_des_etats( automate ) <= 2 * (long long) i + 64 ){
+		reconstruire_indices_directs( automate );
 	}
-	// On ajoute les lettres
+
+	// Le tableau de bits de l'alphabet.
 	for(
-		it1 = premier_iterateur_ensemble( get_alphabet( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
+		it = premier_iterateur_ensemble( alphabet );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
 	){
-		ajouter_lettre( res, (char) get_element( it1 ) );
+		unsigned char octet = get_element( it );
+		automate->lettres[ octet / 64 ] |= (uint64_t) 1 << ( octet % 64 );
 	}
-	// On ajoute les transitions
-	Table_iterateur it2;
+
+	ranger_transitions( automate, transitions, nb_transitions, 1 );
+	return automate;
+}
+
+/*
+ * Oublie les informations calculées à partir de l'automate. Toute fonction
+ * qui modifie l'automate doit l'appeler.
+ */
+void invalider_caches( Automate * automate ){
+	if( automate->co_accessibles ){
+		liberer_ensemble( automate->co_accessibles );
+		automate->co_accessibles = NULL;
+	}
+}
+
+void pour_toute_transition_vers_le_puits(
+	const Automate* automate,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+);
+
+void fixer_etat_puits( Automate * automate, int puits );
+
+typedef struct {
+	Automate * automate;
+	int translation;
+} data_ajouter_transition_vue_t;
+
+void action_ajouter_transition_vue(
+	int origine, char lettre, int fin, void* data
+){
+	data_ajouter_transition_vue_t * d = (data_ajouter_transition_vue_t*) data;
+	ajouter_transition(
+		d->automate, origine + d->translation, lettre, fin + d->translation
+	);
+}
+
+/*
+ * Ajoute à 'res' les états, les lettres et les transitions de la vue.
+ * Les ensembles d'arrivée de chaque (origine, lettre) sont recopiés en bloc :
+ * on ne repasse pas par ajouter_transition() pour chaque transition.
+ *
+ * Si 'seule' est vrai, 'res' ne contient rien d'autre que la vue, ni
+ * maintenant ni après : son état puits peut y rester implicite.
+ */
+void ajouter_vue( Automate * res, Vue_automate vue, int seule ){
+	const Automate * automate = vue.automate;
+	int translation = vue.translation;
+	invalider_caches( res );
+	ecrire_composante( res, COMPOSANTE_INITIAUX );
+	ecrire_composante( res, COMPOSANTE_FINAUX );
+	ecrire_composante( res, COMPOSANTE_TRANSITIONS );
+
+	Ensemble_iterateur it;
 	for(
-		it2 = premier_iterateur_table( automate->transitions );
-		! iterateur_est_vide( it2 );
-		it2 = iterateur_suivant_table( it2 )
+		it = premier_iterateur_ensemble( get_etats( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
 	){
-		Cle * cle = (Cle*) get_cle( it2 );
-		Ensemble * fins = (Ensemble*) get_valeur( it2 );
+		enregistrer_etat( res, get_element( it ) + translation );
+	}
+	for(
+		it = premier_iterateur_ensemble( get_initiaux( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_element( res->initiaux, get_element( it ) + translation );
+	}
+	for(
+		it = premier_iterateur_ensemble( get_finaux( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_element( res->finaux, get_element( it ) + translation );
+	}
+	ajouter_lettres( res, get_alphabet( automate ) );
+
+	Table_iterateur it1;
+	for(
+		it1 = premier_iterateur_table( automate->transitions );
+		! iterateur_est_vide( it1 );
+		it1 = iterateur_suivant_table( it1 )
+	){
+		Cle * cle = (Cle*) get_cle( it1 );
+		Ensemble * fins = (Ensemble*) get_valeur( it1 );
+
+		Cle nouvelle_cle;
+		initialiser_cle( &nouvelle_cle, cle->origine + translation, cle->lettre );
+		Table_iterateur it2 = trouver_table(
+			res->transitions, (intptr_t) &nouvelle_cle
+		);
+		Ensemble * nouvelles_fins = reprendre_arrivees(
+			res,
+			iterateur_est_vide( it2 ) ? NULL : (Ensemble*) get_valeur( it2 )
+		);
 		for(
-			it1 = premier_iterateur_ensemble( fins );
-			! iterateur_ensemble_est_vide( it1 );
-			it1 = iterateur_suivant_ensemble( it1 )
+			it = premier_iterateur_ensemble( fins );
+			! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
 		){
-			int fin = get_element( it1 );
-			ajouter_transition( res, cle->origine, cle->lettre, fin );
+			int taille = taille_ensemble( nouvelles_fins );
+			ajouter_element( nouvelles_fins, get_element( it ) + translation );
+			if( taille_ensemble( nouvelles_fins ) != taille ){
+				indexer_entrante(
+					res, nouvelle_cle.origine, nouvelle_cle.lettre,
+					get_element( it ) + translation
+				);
+			}
 		}
+		ranger_arrivees( res, &it2, &nouvelle_cle, nouvelles_fins );
+	}
+
+	if( seule && automate->puits ){
+		fixer_etat_puits( res, get_etat_puits( automate ) + translation );
+		return;
 	}
+
+	// 'res' peut contenir d'autres automates : l'état puits de la vue ne
+	// peut pas y rester implicite.
+	data_ajouter_transition_vue_t data;
+	data.automate = res;
+	data.translation = translation;
+	pour_toute_transition_vers_le_puits(
+		automate, action_ajouter_transition_vue, &data
+	);
+}
+
+Vue_automate vue_automate( const Automate * automate, int translation ){
+	Vue_automate vue;
+	vue.automate = automate;
+	vue.translation = translation;
+	return vue;
+}
+
+Automate * materialiser_vue( Vue_automate vue ){
+	Automate * res = creer_automate();
+	ajouter_vue( res, vue, 1 );
 	return res;
 }
 
-Automate * translater_automate(
-	const Automate * automate, const Automate * automate_a_eviter
+Automate * translater_automate_entier( const Automate* automate, int translation ){
+	return materialiser_vue( vue_automate( automate, translation ) );
+}
+
+
+/*
+ * Libère les données d'une composante de l'automate, sans tenir compte du
+ * partage.
+ */
+void liberer_composante( Automate * automate, enum Composante composante ){
+	switch( composante ){
+		case COMPOSANTE_ETATS :
+			liberer_ensemble( automate->etats );
+			liberer_table( automate->indices );
+			xfree( automate->etats_par_indice );
+			xfree( automate->indices_directs );
+			break;
+		case COMPOSANTE_ALPHABET :
+			liberer_ensemble( automate->alphabet );
+			break;
+		case COMPOSANTE_TRANSITIONS :
+			liberer_table( automate->arrivees );
+			liberer_table( automate->transitions );
+			if( automate->entrantes ) liberer_table( automate->entrantes );
+			break;
+		case COMPOSANTE_INITIAUX :
+			liberer_ensemble( automate->initiaux );
+			break;
+		case COMPOSANTE_FINAUX :
+			liberer_ensemble( automate->finaux );
+			break;
+		default :
+			assert( 0 );
+	}
+}
+
+/*
+ * Remplace une composante de l'automate par une copie qui lui est propre.
+ */
+void dupliquer_composante( Automate * automate, enum Composante composante ){
+	switch( composante ){
+		case COMPOSANTE_ETATS : {
+			int nb_etats = taille_ensemble( automate->etats );
+			const int * etats_par_indice = automate->etats_par_indice;
+			automate->etats = copier_ensemble( automate->etats );
+			automate->indices = copier_table( automate->indices, NULL, NULL );
+			automate->etats_par_indice = xmalloc(
+				( automate->capacite_indices + 1 ) * sizeof(int)
+			);
+			if( nb_etats > 0 ){
+				memcpy(
+					automate->etats_par_indice, etats_par_indice,
+					nb_etats * sizeof(int)
+				);
+			}
+			if( automate->indices_directs ){
+				const int * indices_directs = automate->indices_directs;
+				automate->indices_directs = xmalloc(
+					automate->taille_indices_directs * sizeof(int)
+				);
+				memcpy(
+					automate->indices_directs, indices_directs,
+					automate->taille_indices_directs * sizeof(int)
+				);
+			}
+			break;
+		}
+		case COMPOSANTE_ALPHABET :
+			automate->alphabet = copier_ensemble( automate->alphabet );
+			break;
+		case COMPOSANTE_TRANSITIONS :
+			// Les deux tables sont copiées en temps constant ; les
+			// ensembles d'arrivée, jamais modifiés, restent partagés.
+			automate->transitions = copier_table(
+				automate->transitions, NULL, NULL
+			);
+			automate->arrivees = copier_table( automate->arrivees, NULL, NULL );
+			if( automate->entrantes ){
+				automate->entrantes = copier_table(
+					automate->entrantes, NULL, NULL
+				);
+			}
+			break;
+		case COMPOSANTE_INITIAUX :
+			automate->initiaux = copier_ensemble( automate->initiaux );
+			break;
+		case COMPOSANTE_FINAUX :
+			automate->finaux = copier_ensemble( automate->finaux );
+			break;
+		default :
+			assert( 0 );
+	}
+}
+
+/*
+ * Renvoie 1 si la composante est partagée avec d'autres automates.
+ */
+int composante_partagee(
+	const Automate * automate, enum Composante composante
 ){
+	return atomic_load( automate->references[ composante ] ) > 1;
+}
+
+/*
+ * Rend la composante propre à l'automate, en la dupliquant si elle est
+ * partagée avec d'autres automates. Toute fonction qui modifie une
+ * composante doit l'appeler avant.
+ */
+void ecrire_composante( Automate * automate, enum Composante composante ){
+	atomic_int * references = automate->references[ composante ];
+	if( atomic_load( references ) == 1 ){
+		return;
+	}
+	Automate ancien = *automate;
+	dupliquer_composante( automate, composante );
+	automate->references[ composante ] = creer_compte_de_references();
+	// Les autres détenteurs ont pu lâcher la composante entre-temps.
+	lacher_composante( &ancien, composante );
+}
+
+/*
+ * Lâche une composante de l'automate : ses données ne sont libérées que si
+ * aucun autre automate ne la partage.
+ */
+void lacher_composante( Automate * automate, enum Composante composante ){
+	atomic_int * references = automate->references[ composante ];
+	if( atomic_fetch_sub( references, 1 ) > 1 ){
+		return;
+	}
+	xfree( references );
+	liberer_composante( automate, composante );
+}
+
+void liberer_automate( Automate * automate ){
+	assert( automate );
+	invalider_caches( automate );
+	liberer_ensemble( automate->puits );
+	liberer_ensemble( automate->vide );
+	int i;
+	for( i=0; i<NB_COMPOSANTES; i++ ){
+		lacher_composante( automate, i );
+	}
+	xfree(automate);
+}
+
+const Ensemble * get_etats( const Automate* automate ){
+	return automate->etats;
+}
+
+const Ensemble * get_initiaux( const Automate* automate ){
+	return automate->initiaux;
+}
+
+const Ensemble * get_finaux( const Automate* automate ){
+	return automate->finaux;
+}
+
+const Ensemble * get_alphabet( const Automate* automate ){
+	return automate->alphabet;
+}
+
+/*
+ * Ajoute l'état à l'ensemble des états et, s'il est nouveau, lui donne
+ * l'indice dense suivant et met à jour les états extrêmes. Renvoie 1 si
+ * l'état est nouveau, 0 sinon.
+ */
+int enregistrer_etat( Automate * automate, int etat ){
 	if(
-		taille_ensemble( get_etats(automate) ) == 0 ||
-		taille_ensemble( get_etats(automate_a_eviter) ) == 0
+		composante_partagee( automate, COMPOSANTE_ETATS )
+		&& est_dans_l_ensemble( automate->etats, etat )
 	){
-		return copier_automate( automate );
+		return 0;
 	}
-	
-	int translation = 
-		get_max_etat( automate_a_eviter ) - get_min_etat( automate ) + 1; 
+	ecrire_composante( automate, COMPOSANTE_ETATS );
+	int n = taille_ensemble( automate->etats );
+	ajouter_element( automate->etats, etat );
+	if( taille_ensemble( automate->etats ) == n ){
+		return 0;
+	}
+	if( n == automate->capacite_indices ){
+		automate->capacite_indices = n ? 2 * n : 8;
+		automate->etats_par_indice = xrealloc(
+			automate->etats_par_indice,
+			automate->capacite_indices * sizeof(int)
+		);
+	}
+	automate->etats_par_indice[n] = etat;
+	add_table( automate->indices, etat, n );
+	if( etat < automate->min_etat ) automate->min_etat = etat;
+	if( etat > automate->max_etat ) automate->max_etat = etat;
+	placer_indice_direct( automate, etat, n );
+	return 1;
+}
+
+void ajouter_etat( Automate * automate, int etat ){
+	// Un nouvel état peut mener au puits implicite ; un état déjà présent ne
+	// change rien.
+	if( enregistrer_etat( automate, etat ) ){
+		invalider_caches( automate );
+	}
+}
+
+int indice_de_l_etat( const Automate * automate, int etat ){
+	if( automate->indices_directs ){
+		long long place = (long long) etat - automate->base_indices;
+		if( place < 0 || place >= automate->taille_indices_directs ){
+			return -1;
+		}
+		return automate->indices_directs[ place ];
+	}
+	Table_iterateur it = trouver_table( automate->indices, etat );
+	if( iterateur_est_vide( it ) ){
+		return -1;
+	}
+	return get_valeur( it );
+}
+
+int etat_de_l_indice( const Automate * automate, int indice ){
+	assert( indice >= 0 && indice < taille_ensemble( automate->etats ) );
+	return automate->etats_par_indice[ indice ];
+}
 
-	return translater_automate_entier( automate, translation );
+/*
+ * Les lettres sont rangées comme des octets non signés, de 0 à 255, dans
+ * l'ensemble des lettres comme dans le tableau de bits.
+ */
+void ajouter_lettre( Automate * automate, char lettre ){
+	unsigned char octet = (unsigned char) lettre;
+	if( ( automate->lettres[ octet / 64 ] >> ( octet % 64 ) ) & 1 ){
+		return;
+	}
+	invalider_caches( automate );
+	ecrire_composante( automate, COMPOSANTE_ALPHABET );
+	ajouter_element( automate->alphabet, octet );
+	automate->lettres[ octet / 64 ] |= (uint64_t) 1 << ( octet % 64 );
+}
+
+/*
+ * Ajoute à l'alphabet de l'automate toutes les lettres de 'alphabet'.
+ */
+void ajouter_lettres( Automate * automate, const Ensemble * alphabet ){
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( alphabet );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_lettre( automate, (char) get_element( it ) );
+	}
+}
+
+void ajouter_transition(
+	Automate * automate, int origine, char lettre, int fin
+){
+	ajouter_etat( automate, origine );
+	ajouter_etat( automate, fin );
+	ajouter_lettre( automate, lettre );
 	
+	Cle cle;
+	initialiser_cle( &cle, origine, lettre );
+	Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
+	// Une transition déjà présente ne justifie ni de dupliquer la table, ni
+	// de reprendre un ensemble partagé.
+	if(
+		! iterateur_est_vide( it )
+		&& est_dans_l_ensemble( (Ensemble*) get_valeur( it ), fin )
+	){
+		return;
+	}
+	invalider_caches( automate );
+	if( composante_partagee( automate, COMPOSANTE_TRANSITIONS ) ){
+		ecrire_composante( automate, COMPOSANTE_TRANSITIONS );
+		it = trouver_table( automate->transitions, (intptr_t) &cle );
+	}
+	Ensemble * ens = reprendre_arrivees(
+		automate,
+		iterateur_est_vide( it ) ? NULL : (Ensemble*) get_valeur( it )
+	);
+	ajouter_element( ens, fin );
+	ranger_arrivees( automate, &it, &cle, ens );
+	indexer_entrante( automate, origine, lettre, fin );
 }
 
-int est_une_transition_de_l_automate(
+void ajouter_transitions(
+	Automate * automate, Transition * transitions, int nb_transitions
+){
+	invalider_caches( automate );
+	int i, nb;
+	int * extremites = extremites_des_transitions(
+		transitions, nb_transitions, NULL, NULL, &nb
+	);
+	nb = garder_absents( automate->etats, extremites, nb );
+	for( i=0; i<nb; i++ ){
+		enregistrer_etat( automate, extremites[i] );
+	}
+	xfree( extremites );
+	ranger_transitions( automate, transitions, nb_transitions, 0 );
+}
+
+void ajouter_etat_final(
+	Automate * automate, int etat_final
+){
+	ajouter_etat( automate, etat_final );
+	if( ! est_dans_l_ensemble( automate->finaux, etat_final ) ){
+		invalider_caches( automate );
+		ecrire_composante( automate, COMPOSANTE_FINAUX );
+		ajouter_element( automate->finaux, etat_final );
+	}
+}
+
+void ajouter_etat_initial(
+	Automate * automate, int etat_initial
+){
+	ajouter_etat( automate, etat_initial );
+	if( ! est_dans_l_ensemble( automate->initiaux, etat_initial ) ){
+		ecrire_composante( automate, COMPOSANTE_INITIAUX );
+		ajouter_element( automate->initiaux, etat_initial );
+	}
+}
+
+const Ensemble * voisins( const Automate* automate, int origine, char lettre ){
+	Cle cle;
+	initialiser_cle( &cle, origine, lettre );
+	Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
+	if( ! iterateur_est_vide( it ) ){
+		return (Ensemble*) get_valeur( it );
+	}else if(
+		automate->puits && est_une_lettre_de_l_automate( automate, lettre )
+	){
+		return automate->puits;
+	}else{
+		return automate->vide;
+	}
+}
+
+int a_un_etat_puits( const Automate * automate ){
+	return automate->puits != NULL;
+}
+
+int get_etat_puits( const Automate * automate ){
+	assert( automate->puits );
+	return get_element( premier_iterateur_ensemble( automate->puits ) );
+}
+
+void fixer_etat_puits( Automate * automate, int puits ){
+	invalider_caches( automate );
+	ajouter_etat( automate, puits );
+	liberer_ensemble( automate->puits );
+	automate->puits = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( automate->puits, puits );
+}
+
+/*
+ * Passe en revue les transitions implicites vers l'état puits : celles des
+ * (état, lettre) absents de la table des transitions, et, si 'explicites'
+ * est vrai, les transitions de la table, dans l'ordre (origine, lettre).
+ * Les clés de la table étant rangées dans cet ordre, on les parcourt en même
+ * temps que les états et l'alphabet, sans les chercher une à une.
+ */
+void parcourir_transitions_avec_le_puits(
 	const Automate* automate,
-	int origine, char lettre, int fin
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data, int explicites
 ){
-	return est_dans_l_ensemble( voisins( automate, origine, lettre ), fin );
+	int puits = get_etat_puits( automate );
+	Table_iterateur it = premier_iterateur_table( automate->transitions );
+	Ensemble_iterateur it_etat, it_lettre, it_fin;
+	for(
+		it_etat = premier_iterateur_ensemble( get_etats( automate ) );
+		! iterateur_ensemble_est_vide( it_etat );
+		it_etat = iterateur_suivant_ensemble( it_etat )
+	){
+		int origine = get_element( it_etat );
+		for(
+			it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
+			! iterateur_ensemble_est_vide( it_lettre );
+			it_lettre = iterateur_suivant_ensemble( it_lettre )
+		){
+			int lettre = get_element( it_lettre );
+			const Cle * cle =
+				iterateur_est_vide( it ) ? NULL : (const Cle*) get_cle( it );
+			if( ! cle || cle->origine != origine || cle->lettre != lettre ){
+				action( origine, (char) lettre, puits, data );
+				continue;
+			}
+			if( explicites ){
+				for(
+					it_fin = premier_iterateur_ensemble( (Ensemble*) get_valeur( it ) );
+					! iterateur_ensemble_est_vide( it_fin );
+					it_fin = iterateur_suivant_ensemble( it_fin )
+				){
+					action( origine, (char) lettre, get_element( it_fin ), data );
+				}
+			}
+			it = iterateur_suivant_table( it );
+		}
+	}
 }
 
-int est_un_etat_de_l_automate( const Automate* automate, int etat ){
-	return est_dans_l_ensemble( get_etats( automate ), etat );
+void pour_toute_transition_vers_le_puits(
+	const Automate* automate,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+){
+	if( automate->puits ){
+		parcourir_transitions_avec_le_puits( automate, action, data, 0 );
+	}
+}
+
+Ensemble * delta1(
+	const Automate* automate, int origine, char lettre
+){
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+	ajouter_elements( res, voisins( automate, origine, lettre ) );
+	return res; 
+}
+
+Ensemble * delta(
+	const Automate* automate, const Ensemble * etats_courants, char lettre
+){
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+
+	Ensemble_iterateur it;
+	for( 
+		it = premier_iterateur_ensemble( etats_courants );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		const Ensemble * fins = voisins(
+			automate, get_element( it ), lettre
+		);
+		ajouter_elements( res, fins );
+	}
+
+	return res;
+}
+
+Ensemble * delta_star(
+	const Automate* automate, const Ensemble * etats_courants, const char* mot
+){
+	return delta_star_binaire( automate, etats_courants, mot, strlen( mot ) );
+}
+
+Ensemble * delta_star_binaire(
+	const Automate* automate, const Ensemble * etats_courants,
+	const char* mot, int len
+){
+	int i;
+	Ensemble * old = copier_ensemble( etats_courants );
+	Ensemble * new = old;
+	// Une fois l'ensemble courant vide, il le reste.
+	for( i=0; i<len && taille_ensemble( old ) > 0; i++ ){
+		new = delta( automate, old, *(mot+i) );
+		liberer_ensemble( old );
+		old = new;
+	}
+	return new;
+}
+
+Ensemble * delta1_vue( Vue_automate vue, int origine, char lettre ){
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble(
+			voisins( vue.automate, origine - vue.translation, lettre )
+		);
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_element( res, get_element( it ) + vue.translation );
+	}
+	return res;
+}
+
+Ensemble * delta_vue(
+	Vue_automate vue, const Ensemble * etats_courants, char lettre
+){
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+
+	Ensemble_iterateur it1, it2;
+	for( 
+		it1 = premier_iterateur_ensemble( etats_courants );
+		! iterateur_ensemble_est_vide( it1 );
+		it1 = iterateur_suivant_ensemble( it1 )
+	){
+		const Ensemble * fins = voisins(
+			vue.automate, get_element( it1 ) - vue.translation, lettre
+		);
+		for(
+			it2 = premier_iterateur_ensemble( fins );
+			! iterateur_ensemble_est_vide( it2 );
+			it2 = iterateur_suivant_ensemble( it2 )
+		){
+			ajouter_element( res, get_element( it2 ) + vue.translation );
+		}
+	}
+
+	return res;
+}
+
+typedef struct {
+	void (* action )( int origine, char lettre, int fin, void* data );
+	void* data;
+	int translation;
+} data_pour_toute_transition_vue_t;
+
+void action_pour_toute_transition_vue(
+	int origine, char lettre, int fin, void* data
+){
+	data_pour_toute_transition_vue_t * d =
+		(data_pour_toute_transition_vue_t*) data;
+	d->action(
+		origine + d->translation, lettre, fin + d->translation, d->data
+	);
+}
+
+void pour_toute_transition_vue(
+	Vue_automate vue,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+){
+	data_pour_toute_transition_vue_t d;
+	d.action = action;
+	d.data = data;
+	d.translation = vue.translation;
+	pour_toute_transition( vue.automate, action_pour_toute_transition_vue, &d );
+}
+
+/*
+ * Passe en revue les seules transitions de la table, sans celles du puits.
+ */
+void pour_toute_transition_explicite(
+	const Automate* automate,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+){
+	Table_iterateur it1;
+	Ensemble_iterateur it2;
+	for(
+		it1 = premier_iterateur_table( automate->transitions );
+		! iterateur_est_vide( it1 );
+		it1 = iterateur_suivant_table( it1 )
+	){
+		Cle * cle = (Cle*) get_cle( it1 );
+		Ensemble * fins = (Ensemble*) get_valeur( it1 );
+		for(
+			it2 = premier_iterateur_ensemble( fins );
+			! iterateur_ensemble_est_vide( it2 );
+			it2 = iterateur_suivant_ensemble( it2 )
+		){
+			int fin = get_element( it2 );
+			action( cle->origine, cle->lettre, fin, data );
+		}
+	};
+}
+
+void pour_toute_transition(
+	const Automate* automate,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+){
+	if( automate->puits ){
+		parcourir_transitions_avec_le_puits( automate, action, data, 1 );
+	}else{
+		pour_toute_transition_explicite( automate, action, data );
+	}
+}
+
+Automate* copier_automate( const Automate* automate ){
+	int i;
+	for( i=0; i<NB_COMPOSANTES; i++ ){
+		atomic_fetch_add( automate->references[i], 1 );
+	}
+	Automate * res = xmalloc( sizeof(Automate) );
+	*res = *automate;
+	res->vide = creer_ensemble( NULL, NULL, NULL );
+	res->co_accessibles = NULL;
+	res->puits = NULL;
+	// L'état puits reste implicite
+	if( automate->puits ){
+		res->puits = copier_ensemble( automate->puits );
+	}
+	return res;
+}
+
+Partage_des_arrivees partage_des_arrivees( const Automate * automate ){
+	Partage_des_arrivees partage;
+	partage.nb_couples = taille_table( automate->transitions );
+	partage.nb_ensembles = taille_table( automate->arrivees );
+	partage.nb_fins = 0;
+	partage.nb_fins_stockees = 0;
+	Table_iterateur it;
+	for(
+		it = premier_iterateur_table( automate->arrivees );
+		! iterateur_est_vide( it );
+		it = iterateur_suivant_table( it )
+	){
+		int taille = taille_ensemble( (Ensemble*) get_cle( it ) );
+		partage.nb_fins_stockees += taille;
+		partage.nb_fins += taille * get_valeur( it );
+	}
+	return partage;
+}
+
+Vue_automate vue_translatee(
+	const Automate * automate, const Automate * automate_a_eviter
+){
+	if(
+		taille_ensemble( get_etats(automate) ) == 0 ||
+		taille_ensemble( get_etats(automate_a_eviter) ) == 0
+	){
+		return vue_automate( automate, 0 );
+	}
+	
+	int translation = 
+		get_max_etat( automate_a_eviter ) - get_min_etat( automate ) + 1; 
+
+	return vue_automate( automate, translation );
+}
+
+Automate * translater_automate(
+	const Automate * automate, const Automate * automate_a_eviter
+){
+	return materialiser_vue( vue_translatee( automate, automate_a_eviter ) );
+}
+
+int est_une_transition_de_l_automate(
+	const Automate* automate,
+	int origine, char lettre, int fin
+){
+	return est_dans_l_ensemble( voisins( automate, origine, lettre ), fin );
+}
+
+int est_un_etat_de_l_automate( const Automate* automate, int etat ){
+	return est_dans_l_ensemble( get_etats( automate ), etat );
+}
+
+int est_un_etat_initial_de_l_automate( const Automate* automate, int etat ){
+	return est_dans_l_ensemble( get_initiaux( automate ), etat );
+}
+
+int est_un_etat_final_de_l_automate( const Automate* automate, int etat ){
+	return est_dans_l_ensemble( get_finaux( automate ), etat );
+}
+
+int est_une_lettre_de_l_automate( const Automate* automate, char lettre ){
+	unsigned char octet = (unsigned char) lettre;
+	return ( automate->lettres[ octet / 64 ] >> ( octet % 64 ) ) & 1;
+}
+
+void print_ensemble_2( const intptr_t ens ){
+	print_ensemble( (Ensemble*) ens, NULL );
+}
+
+void print_lettre( intptr_t c ){
+	printf("%c", (char) c );
+}
+
+void print_automate( const Automate * automate ){
+	printf("- Etats : ");
+	print_ensemble( get_etats( automate ), NULL );
+	printf("\n- Initiaux : ");
+	print_ensemble( get_initiaux( automate ), NULL );
+	printf("\n- Finaux : ");
+	print_ensemble( get_finaux( automate ), NULL );
+	printf("\n- Alphabet : ");
+	print_ensemble( get_alphabet( automate ), print_lettre );
+	if( automate->puits ){
+		printf("\n- Puits implicite : %d", get_etat_puits( automate ) );
+	}
+	printf("\n- Transitions : ");
+	print_table( 
+		automate->transitions,
+		( void (*)( const intptr_t ) ) print_cle, 
+		( void (*)( const intptr_t ) ) print_ensemble_2,
+		""
+	);
+	printf("\n");
+}
+
+/*
+ * Comme delta, mais ne conserve que les états de 'utiles'.
+ */
+Ensemble * delta_utile(
+	const Automate* automate, const Ensemble * etats_courants, char lettre,
+	const Ensemble * utiles
+){
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+
+	Ensemble_iterateur it, it_fin;
+	for(
+		it = premier_iterateur_ensemble( etats_courants );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		const Ensemble * fins = voisins( automate, get_element( it ), lettre );
+		for(
+			it_fin = premier_iterateur_ensemble( fins );
+			! iterateur_ensemble_est_vide( it_fin );
+			it_fin = iterateur_suivant_ensemble( it_fin )
+		){
+			if( est_dans_l_ensemble( utiles, get_element( it_fin ) ) ){
+				ajouter_element( res, get_element( it_fin ) );
+			}
+		}
+	}
+
+	return res;
+}
+
+/*/
+ * Si etats_co_accessibles() a été appelée, le_mot_est_reconnu ne garde que
+ * les états co-accessibles : les autres ne peuvent pas mener à un état
+ * final. La lecture s'arrête dès que l'ensemble des états courants est vide,
+ * le mot est alors rejeté.
+/*/
+int le_mot_est_reconnu( const Automate* automate, const char* mot ){
+	return le_mot_binaire_est_reconnu( automate, mot, strlen( mot ) );
+}
+
+int le_mot_binaire_est_reconnu(
+	const Automate* automate, const char* mot, int longueur
+){
+	// Le cache n'est que lu : l'automate n'est pas modifié, et plusieurs
+	// lectures peuvent avoir lieu en même temps.
+	const Ensemble * utiles = automate->co_accessibles;
+	Ensemble * courants = utiles ?
+		creer_intersection_ensemble( get_initiaux( automate ), utiles ) :
+		copier_ensemble( get_initiaux( automate ) );
+	int i;
+	for( i=0; i<longueur && taille_ensemble( courants ) > 0; i++ ){
+		Ensemble * suivants = utiles ?
+			delta_utile( automate, courants, mot[i], utiles ) :
+			delta( automate, courants, mot[i] );
+		liberer_ensemble( courants );
+		courants = suivants;
+	}
+
+	int result = 0;
+
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( courants );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		if( est_un_etat_final_de_l_automate( automate, get_element(it) ) ){
+			result = 1;
+			break;
+		}
+	}
+	liberer_ensemble( courants );
+	return result;
+}
+
+Automate * mot_to_automate( const char * mot ){
+	Automate * automate = creer_automate();
+	int i = 0;
+	int size = strlen( mot );
+	for( i=0; i < size; i++ ){
+		ajouter_transition( automate, i, mot[i], i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, size );
+	return automate;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// PROJET D'INFORMATIQUE THÉORIQUE 2015-2016                                                         //
+//                                                                                                   //
+// Fonctions à implémenter :                                                                         //
+// int get_max_etat( const Automate* automate );                                                     //
+// Automate * creer_union_des_automates( const Automate * automate_1, const Automate * automate_2 ); //
+// Ensemble* etats_accessibles( const Automate * automate, int etat );                               //
+// Ensemble* accessibles( const Automate * automate );                                               //
+// Automate *automate_accessible( const Automate * automate );                                       //
+// Automate *miroir( const Automate * automate);                                                     //
+// Automate * creer_automate_du_melange( const Automate* automate_1,  const Automate* automate_2 );  //
+//                                                                                                   //
+// Notes :                                                                                           //
+// Les fonctionnalités sont purement implémentées : ne sachant quelle utilisation est censée en être //
+// faite, il a été choisi de respecter strictement la demande. Par exemple, la fonction miroir ne    //
+// cherche pas à supprimer les états inaccessibles. Les optimisations sont laissées à l'utilisateur. //
+// Aucun zèle.                                                                                       //
+// De plus, puisque nous sommes dans le module-même, nous conservons le droit d'accéder directement  //
+// aux champs de la structure Automate si ceux-ci clarifient le code.                                //
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*/
+ * get_max_etat retourne l'etat ayant l'étiquette la plus grande.
+ * Comme get_min_etat, elle lit le maximum tenu à jour par ajouter_etat.
+/*/
+int get_max_etat( const Automate* automate ){
+	return automate->max_etat;
+}
+
+/*/
+ * Les transitions de l'index sont rangées par indice dense de leur fin (voir
+ * indice_de_l_etat), puis par lettre : celles qui arrivent dans l'état
+ * d'indice i occupent les cases debut[i] à debut[i+1]-1.
+ *
+ * Deux tris par paquets, par lettre puis par fin, coûtent O(|Q|+|δ|+256),
+ * auxquels s'ajoute la lecture de l'indice de chaque fin : en temps
+ * constant avec le tableau direct de l'automate, en O(log |Q|) sinon.
+ * C'est aussi la construction du graphe inversé des parcours.
+/*/
+struct Predecesseurs {
+	const Automate * automate;
+	int * debut;
+	unsigned char * lettre;
+	int * origine;
+};
+
+typedef struct {
+	Predecesseurs * predecesseurs;
+	int * places;        // prochaine case libre, par lettre
+	int * fins;          // indice de la fin, par case
+	int * debut;         // nombre de transitions par fin
+} Donnees_predecesseurs;
+
+void action_compter_predecesseurs( int origine, char lettre, int fin, void* data ){
+	( (Donnees_predecesseurs*) data )->places[ (unsigned char) lettre + 1 ]++;
+}
+
+void action_placer_predecesseurs( int origine, char lettre, int fin, void* data ){
+	Donnees_predecesseurs * d = (Donnees_predecesseurs*) data;
+	int place = d->places[ (unsigned char) lettre ]++;
+	int indice = indice_de_l_etat( d->predecesseurs->automate, fin );
+	d->fins[place] = indice;
+	d->predecesseurs->lettre[place] = (unsigned char) lettre;
+	d->predecesseurs->origine[place] = origine;
+	d->debut[ indice + 1 ]++;
+}
+
+Predecesseurs * creer_predecesseurs( const Automate * automate ){
+	Predecesseurs * res = xmalloc( sizeof(Predecesseurs) );
+	int nb_etats = taille_ensemble( get_etats( automate ) );
+	int i;
+	res->automate = automate;
+	res->debut = xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	for( i=0; i<=nb_etats; i++ ) res->debut[i] = 0;
+
+	// Premier tri, par lettre...
+	Donnees_predecesseurs d;
+	d.predecesseurs = res;
+	d.debut = res->debut;
+	d.places = xmalloc( ( NB_LETTRES + 1 ) * sizeof(int) );
+	for( i=0; i<=NB_LETTRES; i++ ) d.places[i] = 0;
+	pour_toute_transition( automate, action_compter_predecesseurs, &d );
+	for( i=0; i<NB_LETTRES; i++ ) d.places[i+1] += d.places[i];
+	int nb = d.places[ NB_LETTRES ];
+	d.fins = xmalloc( ( nb + 1 ) * sizeof(int) );
+	res->lettre = xmalloc( nb + 1 );
+	res->origine = xmalloc( ( nb + 1 ) * sizeof(int) );
+	pour_toute_transition( automate, action_placer_predecesseurs, &d );
+
+	// ... puis tri stable par fin : chaque bloc reste trié par lettre.
+	for( i=0; i<nb_etats; i++ ) res->debut[i+1] += res->debut[i];
+	unsigned char * lettres = xmalloc( nb + 1 );
+	int * origines = xmalloc( ( nb + 1 ) * sizeof(int) );
+	int * places = xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	for( i=0; i<nb_etats; i++ ) places[i] = res->debut[i];
+	for( i=0; i<nb; i++ ){
+		int place = places[ d.fins[i] ]++;
+		lettres[place] = res->lettre[i];
+		origines[place] = res->origine[i];
+	}
+	xfree( res->lettre );
+	xfree( res->origine );
+	res->lettre = lettres;
+	res->origine = origines;
+
+	xfree( places );
+	xfree( d.fins );
+	xfree( d.places );
+	return res;
+}
+
+void liberer_predecesseurs( Predecesseurs * predecesseurs ){
+	assert( predecesseurs );
+	xfree( predecesseurs->debut );
+	xfree( predecesseurs->lettre );
+	xfree( predecesseurs->origine );
+	xfree( predecesseurs );
+}
+
+const int * get_origines(
+	const Predecesseurs * predecesseurs, int fin, char lettre, int * nb
+){
+	int indice = indice_de_l_etat( predecesseurs->automate, fin );
+	*nb = 0;
+	if( indice < 0 ){
+		return NULL;
+	}
+	unsigned char l = (unsigned char) lettre;
+	const unsigned char * lettres = predecesseurs->lettre;
+	int bas = predecesseurs->debut[indice];
+	int haut = predecesseurs->debut[indice+1];
+	int fin_bloc = haut;
+	// Première transition de lettre >= l.
+	while( bas < haut ){
+		int milieu = ( bas + haut ) / 2;
+		if( lettres[milieu] < l ){
+			bas = milieu + 1;
+		}else{
+			haut = milieu;
+		}
+	}
+	int k = bas;
+	while( k < fin_bloc && lettres[k] == l ) k++;
+	*nb = k - bas;
+	return predecesseurs->origine + bas;
+}
+
+Ensemble * delta_inverse(
+	const Predecesseurs * predecesseurs, const Ensemble * etats, char lettre
+){
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( etats );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		int i, nb;
+		const int * origines = get_origines(
+			predecesseurs, get_element( it ), lettre, &nb
+		);
+		for( i=0; i<nb; i++ ){
+			ajouter_element( res, origines[i] );
+		}
+	}
+	return res;
+}
+
+/*
+ * Retire 'fin' de l'ensemble d'arrivée de (origine, lettre) et supprime la
+ * clé si l'ensemble devient vide. Renvoie 1 si la transition existait.
+ */
+int retirer_fin( Automate * automate, int origine, unsigned char lettre, int fin ){
+	Cle cle;
+	initialiser_cle( &cle, origine, lettre );
+	Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
+	if(
+		iterateur_est_vide( it )
+		|| ! est_dans_l_ensemble( (Ensemble*) get_valeur( it ), fin )
+	){
+		return 0;
+	}
+	if( composante_partagee( automate, COMPOSANTE_TRANSITIONS ) ){
+		ecrire_composante( automate, COMPOSANTE_TRANSITIONS );
+		it = trouver_table( automate->transitions, (intptr_t) &cle );
+	}
+	desindexer_entrante( automate, origine, lettre, fin );
+	Ensemble * fins = (Ensemble*) get_valeur( it );
+	if( taille_ensemble( fins ) == 1 ){
+		delete_table( automate->transitions, (intptr_t) &cle );
+		lacher_arrivees( automate, fins );
+		return 1;
+	}
+	fins = reprendre_arrivees( automate, fins );
+	retirer_element( fins, fin );
+	ranger_arrivees( automate, &it, &cle, fins );
+	return 1;
+}
+
+void indexer_predecesseurs( Automate * automate ){
+	if( automate->entrantes ){
+		return;
+	}
+	ecrire_composante( automate, COMPOSANTE_TRANSITIONS );
+	automate->entrantes = creer_table_des_entrantes();
+	Table_iterateur it;
+	Ensemble_iterateur it_fin;
+	for(
+		it = premier_iterateur_table( automate->transitions );
+		! iterateur_est_vide( it );
+		it = iterateur_suivant_table( it )
+	){
+		const Cle * cle = (const Cle*) get_cle( it );
+		for(
+			it_fin = premier_iterateur_ensemble( (Ensemble*) get_valeur( it ) );
+			! iterateur_ensemble_est_vide( it_fin );
+			it_fin = iterateur_suivant_ensemble( it_fin )
+		){
+			indexer_entrante(
+				automate, cle->origine, cle->lettre, get_element( it_fin )
+			);
+		}
+	}
+}
+
+void retirer_transition(
+	Automate * automate, int origine, char lettre, int fin
+){
+	invalider_caches( automate );
+	retirer_fin( automate, origine, lettre, fin );
+}
+
+/*
+ * Range dans 'entrantes' les couples (origine, lettre) des transitions
+ * explicites qui arrivent dans 'etat', et renvoie leur nombre. Avec l'index,
+ * elles sont lues à partir de la clé (etat, 0, INT_MIN) ; sans, toutes les
+ * clés de la table des transitions sont passées en revue.
+ */
+int transitions_entrantes( const Automate * automate, int etat, Cle ** entrantes ){
+	int nb = 0, capacite = 0;
+	*entrantes = NULL;
+	if( automate->entrantes ){
+		Transition debut = { INT_MIN, 0, etat };
+		Table_iterateur it;
+		for(
+			it = premier_iterateur_table_a_partir_de(
+				automate->entrantes, (intptr_t) &debut
+			);
+			! iterateur_est_vide( it )
+			&& ( (const Transition*) get_cle( it ) )->fin == etat;
+			it = iterateur_suivant_table( it )
+		){
+			const Transition * transition = (const Transition*) get_cle( it );
+			if( nb == capacite ){
+				capacite = capacite ? 2 * capacite : 8;
+				*entrantes = xrealloc( *entrantes, capacite * sizeof(Cle) );
+			}
+			initialiser_cle(
+				&( *entrantes )[ nb++ ], transition->origine, transition->lettre
+			);
+		}
+		return nb;
+	}
+	Table_iterateur it;
+	for(
+		it = premier_iterateur_table( automate->transitions );
+		! iterateur_est_vide( it );
+		it = iterateur_suivant_table( it )
+	){
+		if( ! est_dans_l_ensemble( (Ensemble*) get_valeur( it ), etat ) ){
+			continue;
+		}
+		if( nb == capacite ){
+			capacite = capacite ? 2 * capacite : 8;
+			*entrantes = xrealloc( *entrantes, capacite * sizeof(Cle) );
+		}
+		( *entrantes )[ nb++ ] = *( (const Cle*) get_cle( it ) );
+	}
+	return nb;
+}
+
+void retirer_etat( Automate * automate, int etat ){
+	int indice = indice_de_l_etat( automate, etat );
+	if( indice < 0 ){
+		return;
+	}
+	invalider_caches( automate );
+	int c;
+	for( c=0; c<NB_COMPOSANTES; c++ ){
+		if( c != COMPOSANTE_ALPHABET ) ecrire_composante( automate, c );
+	}
+	int i;
+
+	// Les transitions sortantes : les clés (etat, lettre) sont contiguës
+	// dans la table, on les lit à partir de (etat, 0).
+	unsigned char lettres[ NB_LETTRES ];
+	int nb_lettres = 0;
+	Cle cle;
+	initialiser_cle( &cle, etat, 0 );
+	Table_iterateur it;
+	for(
+		it = premier_iterateur_table_a_partir_de(
+			automate->transitions, (intptr_t) &cle
+		);
+		! iterateur_est_vide( it )
+		&& ( (Cle*) get_cle( it ) )->origine == etat;
+		it = iterateur_suivant_table( it )
+	){
+		lettres[ nb_lettres++ ] = ( (Cle*) get_cle( it ) )->lettre;
+	}
+	for( i=0; i<nb_lettres; i++ ){
+		initialiser_cle( &cle, etat, lettres[i] );
+		Ensemble * fins = (Ensemble*) delete_table(
+			automate->transitions, (intptr_t) &cle
+		);
+		Ensemble_iterateur it_fin;
+		for(
+			it_fin = premier_iterateur_ensemble( fins );
+			! iterateur_ensemble_est_vide( it_fin );
+			it_fin = iterateur_suivant_ensemble( it_fin )
+		){
+			desindexer_entrante( automate, etat, lettres[i], get_element( it_fin ) );
+		}
+		lacher_arrivees( automate, fins );
+	}
+
+	// Les transitions entrantes. Les transitions implicites n'arrivent
+	// que dans le puits, et disparaissent avec lui.
+	Cle * entrantes;
+	int nb_entrantes = transitions_entrantes( automate, etat, &entrantes );
+	for( i=0; i<nb_entrantes; i++ ){
+		retirer_fin( automate, entrantes[i].origine, entrantes[i].lettre, etat );
+	}
+	xfree( entrantes );
+
+	// Le dernier indice prend la place de celui de l'état.
+	int dernier = taille_ensemble( automate->etats ) - 1;
+	int deplace = automate->etats_par_indice[ dernier ];
+	automate->etats_par_indice[ indice ] = deplace;
+	delete_table( automate->indices, etat );
+	if( deplace != etat ){
+		add_table( automate->indices, deplace, indice );
+	}
+	if( automate->indices_directs ){
+		automate->indices_directs[ deplace - automate->base_indices ] = indice;
+		automate->indices_directs[ etat - automate->base_indices ] = -1;
+	}
+
+	retirer_element( automate->etats, etat );
+	if( est_dans_l_ensemble( automate->initiaux, etat ) ){
+		retirer_element( automate->initiaux, etat );
+	}
+	if( est_dans_l_ensemble( automate->finaux, etat ) ){
+		retirer_element( automate->finaux, etat );
+	}
+	if( automate->puits && get_etat_puits( automate ) == etat ){
+		liberer_ensemble( automate->puits );
+		automate->puits = NULL;
+	}
+	if( dernier == 0 ){
+		automate->min_etat = INT_MAX;
+		automate->max_etat = INT_MIN;
+	}else{
+		automate->min_etat = get_element(
+			premier_iterateur_ensemble( automate->etats )
+		);
+		automate->max_etat = get_element(
+			dernier_iterateur_ensemble( automate->etats )
+		);
+	}
+}
+
+/*/
+ * miroir renvoie un automate décrivant l'automate miroir de celui
+ * donné en paramètre.
+ *
+ * Les transitions sont lues dans l'index des prédécesseurs : les origines
+ * des transitions arrivant dans un état par une lettre y sont contiguës, et
+ * deviennent d'un bloc l'ensemble des fins d'une transition du miroir.
+/*/
+
+Automate *miroir( const Automate * automate){
+	// Même alphabet et mêmes états, mais états initiaux et finaux inversés.
+	// Les copies sont confiées directement au nouvel automate.
+	Automate * nouvel_automate = creer_automate_a_partir_de(
+		copier_ensemble( get_etats( automate ) ),
+		copier_ensemble( get_alphabet( automate ) ),
+		copier_ensemble( get_finaux( automate ) ),
+		copier_ensemble( get_initiaux( automate ) ),
+		NULL, 0
+	);
+
+	// Ainsi que des transitions inversés également.
+	Predecesseurs * predecesseurs = creer_predecesseurs( automate );
+	int i, k, nb_etats = taille_ensemble( get_etats( automate ) );
+	for( i=0; i<nb_etats; i++ ){
+		int fin = etat_de_l_indice( automate, i );
+		int fin_bloc = predecesseurs->debut[i+1];
+		for( k = predecesseurs->debut[i]; k < fin_bloc; ){
+			unsigned char lettre = predecesseurs->lettre[k];
+			Ensemble * origines = creer_ensemble( NULL, NULL, NULL );
+			while( k < fin_bloc && predecesseurs->lettre[k] == lettre ){
+				ajouter_element( origines, predecesseurs->origine[k++] );
+			}
+			Cle cle;
+			initialiser_cle( &cle, fin, lettre );
+			ranger_arrivees( nouvel_automate, NULL, &cle, origines );
+		}
+	}
+	liberer_predecesseurs( predecesseurs );
+
+/*
+	Table_iterateur it;
+	for(
+		it = premier_iterateur_table( automate->transitions );
+		! iterateur_est_vide( it );
+		it = iterateur_suivant_table( it )
+	){
+		Cle * cle = (Cle*) get_cle( it2 );
+		Ensemble * fins = (Ensemble*) get_valeur( it2 );
+		for(
+			it1 = premier_iterateur_ensemble( fins );
+			! iterateur_ensemble_est_vide( it1 );
+			it1 = iterateur_suivant_ensemble( it1 )
+		){
+			int fin = get_element( it1 );
+			ajouter_transition( res, cle->origine, cle->lettre, fin );
+		}
+	}
+
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( ens );
+		!iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		lol;
+	}*/
+
+	return nouvel_automate;
+}
+
+/*/
+ * etats_accessibles retourne l'ensemble des etats pouvant être atteints depuis
+ * l'état etat, quelles que soient les lettres nécessaires pour cela.
+ * On utilise delta1 qui renvoie l'ensemble des etats accessibles avec une lettre
+ * précise.
+/*/
+
+Ensemble* etats_accessibles( const Automate * automate, int etat ){
+	Ensemble * ensemble = creer_ensemble( NULL, NULL, NULL );
+
+	// Pour chaque lettre de l'alphabet...
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( get_alphabet(automate) );
+		!iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		// ...on sauvegarde les états voisins de notre état etat.
+		transferer_elements_et_libere( ensemble, delta1( automate, etat, (char) get_element(it) ) );
+	}
+	
+	return ensemble;
+}
+
+/*/
+ * accessibles retourne l'ensemble des états accessibles depuis les états
+ * initiaux de l'automate, c'est-à-dire l'ensemble des états de cet automate,
+ * privé de ses éventuels états inutiles puisqu'inaccessibles.
+/*/
+Ensemble* accessibles( const Automate * automate ){
+	Ensemble * ensemble = creer_ensemble( NULL, NULL, NULL );
+
+	// Pour chaque état initial de l'automate...
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( get_initiaux(automate) );
+		!iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		// ...on sauvegarde les états accessibles depuis cet état.
+		transferer_elements_et_libere( ensemble, etats_accessibles( automate, (int) get_element(it) ) );
+	}
+
+	return ensemble;
+}
+
+/*/
+ * automate_accessible retourne un automate reconnaissant le même langage
+ * que l'automate en paramètre, mais allégé de ses états inutiles.
+ *
+ * "Inutiles" est un terme important car il ne s'agit pas que de ses états
+ * inaccessibles, mais aussi des puits (états inaccessibles de l'automate
+ * miroir). Ici, cette propriété n'est pas utilisée, mais de mon avis,
+ * elle devrait l'être.
+/*/
+typedef struct {
+	const Ensemble * etats;
+	Transition * transitions;
+	int nb;
+	int capacite;
+	int perdues; // transitions d'un état conservé vers un état supprimé
+} Donnees_accessible;
+
+void automate_accessible_action( int origine, char lettre, int fin, void * data ){
+	Donnees_accessible * d = (Donnees_accessible*) data;
+
+	if(
+		est_dans_l_ensemble( d->etats, origine )
+		&& ! est_dans_l_ensemble( d->etats, fin )
+	){
+		d->perdues++;
+	}
+	if ( est_dans_l_ensemble( d->etats, origine ) && est_dans_l_ensemble( d->etats, fin ) ){
+		if( d->nb == d->capacite ){
+			d->capacite = d->capacite ? 2 * d->capacite : 16;
+			d->transitions = xrealloc(
+				d->transitions, d->capacite * sizeof(Transition)
+			);
+		}
+		d->transitions[ d->nb ].origine = origine;
+		d->transitions[ d->nb ].lettre = lettre;
+		d->transitions[ d->nb ].fin = fin;
+		d->nb++;
+	}
+}
+
+Automate *automate_accessible( const Automate * automate ){
+	// Comme dit dans la description, il ne faut garder que les états utiles.
+	Ensemble * ensemble = accessibles( automate );
+
+	// Ne restent plus que les transitions.
+	// On ne garde que celles ayant pour origine et fin un état conservé.
+	Donnees_accessible d;
+	d.etats = ensemble;
+	d.transitions = NULL;
+	d.nb = 0;
+	d.capacite = 0;
+	d.perdues = 0;
+	pour_toute_transition_explicite( automate, automate_accessible_action, &d );
+
+	// Si le puits est conservé, les transitions implicites entre états
+	// conservés sont exactement celles qui y mènent : il peut rester
+	// implicite, sauf si une transition supprimée laissait un couple
+	// (état, lettre) sans arrivée, qui mènerait alors au puits.
+	int puits_implicite = 0;
+	if(
+		a_un_etat_puits( automate )
+		&& est_dans_l_ensemble( ensemble, get_etat_puits( automate ) )
+	){
+		if( d.perdues == 0 ){
+			puits_implicite = 1;
+		}else{
+			pour_toute_transition_vers_le_puits(
+				automate, automate_accessible_action, &d
+			);
+		}
+	}
+
+	// L'alphabet est le même.
+	// Certes, il est possible que certaines lettres n'apparaissent plus
+	// dans l'automate final, cependant, le langage qu'il reconnaît ne
+	// change pas, donc son alphabet non plus.
+	// On rajoute ensuite les états initiaux et finaux non supprimés.
+	Automate * nouvel_automate = creer_automate_a_partir_de(
+		ensemble,
+		copier_ensemble( get_alphabet( automate ) ),
+		creer_intersection_ensemble( ensemble, get_initiaux( automate ) ),
+		creer_intersection_ensemble( ensemble, get_finaux( automate ) ),
+		d.transitions, d.nb
+	);
+	xfree( d.transitions );
+
+	if( puits_implicite ){
+		fixer_etat_puits( nouvel_automate, get_etat_puits( automate ) );
+	}
+
+	return nouvel_automate;
+}
+
+/*/
+ * creer_union_des_vues ajoute chaque vue à l'automate résultat.
+ *
+ * creer_union_de_n_automates calcule d'abord toutes les translations, puis
+ * construit l'union des vues correspondantes en une seule passe, sans
+ * recopier d'automate translaté intermédiaire.
+/*/
+/*
+ * Une vue sans état ni lettre n'ajoute rien à l'union.
+ */
+int est_une_vue_vide( Vue_automate vue ){
+	return
+		taille_ensemble( get_etats( vue.automate ) ) == 0
+		&& taille_ensemble( get_alphabet( vue.automate ) ) == 0;
+}
+
+Automate * creer_union_des_vues( const Vue_automate * vues, int nb_vues ){
+	Automate * automate_final = creer_automate();
+	int i, nb_non_vides = 0;
+	for( i=0; i<nb_vues; i++ ){
+		if( ! est_une_vue_vide( vues[i] ) ) nb_non_vides++;
+	}
+	for( i=0; i<nb_vues; i++ ){
+		ajouter_vue( automate_final, vues[i], nb_non_vides <= 1 );
+	}
+	return automate_final;
+}
+
+Automate * creer_union_de_n_automates(
+	const Automate ** automates, int nb_automates, int * translations
+){
+	Automate * automate_final = creer_automate();
+
+	// Le premier automate non vide garde ses états, les suivants sont
+	// translatés juste au-dessus du plus grand état déjà placé.
+	int premier = 1;
+	int max_place = 0;
+	int i, nb_non_vides = 0;
+	for( i=0; i<nb_automates; i++ ){
+		if( ! est_une_vue_vide( vue_automate( automates[i], 0 ) ) ){
+			nb_non_vides++;
+		}
+	}
+	for( i=0; i<nb_automates; i++ ){
+		const Automate * automate = automates[i];
+		int translation = 0;
+		if( taille_ensemble( get_etats( automate ) ) != 0 ){
+			if( ! premier ){
+				translation = max_place - get_min_etat( automate ) + 1;
+			}
+			max_place = get_max_etat( automate ) + translation;
+			premier = 0;
+		}
+		if( translations ) translations[i] = translation;
+		ajouter_vue(
+			automate_final, vue_automate( automate, translation ),
+			nb_non_vides <= 1
+		);
+	}
+
+	return automate_final;
+}
+
+/*/
+ * creer_union_des_automates translate automate_1 au-dessus de automate_2,
+ * comme le fait translater_automate().
+/*/
+Automate * creer_union_des_automates( const Automate * automate_1, const Automate * automate_2 ){
+	const Automate * automates[2];
+	automates[0] = automate_2;
+	automates[1] = automate_1;
+	return creer_union_de_n_automates( automates, 2, NULL );
+}
+
+/*/
+ * Les états des automates construits à partir d'autres automates (couples
+ * d'états pour le mélange et le produit, ensembles d'états pour le
+ * déterminisé) sont numérotés à la volée : une table associe à chaque clé
+ * déjà rencontrée son numéro, et une pile garde les clés restant à traiter.
+ * Seuls les états accessibles sont donc construits.
+/*/
+typedef struct {
+	int premier;
+	int second;
+} Couple;
+
+int comparer_couple( const Couple * a, const Couple * b ){
+	if( a->premier < b->premier )
+		return -1;
+	if( a->premier > b->premier )
+		return 1;
+	if( a->second < b->second )
+		return -1;
+	if( a->second > b->second )
+		return 1;
+	return 0;
+}
+
+Couple * creer_couple( int premier, int second ){
+	Couple * res = xmalloc( sizeof(Couple) );
+	res->premier = premier;
+	res->second = second;
+	return res;
+}
+
+Couple * copier_couple( const Couple * couple ){
+	return creer_couple( couple->premier, couple->second );
+}
+
+void supprimer_couple( Couple * couple ){
+	xfree( couple );
+}
+
+typedef struct {
+	Table * numeros;   // clé -> numéro de l'état
+	Fifo * a_traiter;  // Copies des clés dont l'état reste à construire
+	int nb_etats;
+	intptr_t (*copier_cle)( const intptr_t cle );
+	void (*supprimer_cle)( intptr_t cle );
+	// Pour les couples d'états, les deux automates dont ils sont issus.
+	const Automate * premier;
+	const Automate * second;
+} Numerotation;
+
+void initialiser_numerotation(
+	Numerotation * num,
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)( intptr_t cle )
+){
+	num->numeros = creer_table( comparer_cle, copier_cle, supprimer_cle );
+	num->a_traiter = creer_fifo();
+	num->nb_etats = 0;
+	num->copier_cle = copier_cle;
+	num->supprimer_cle = supprimer_cle;
+	num->premier = NULL;
+	num->second = NULL;
+}
+
+void initialiser_numerotation_couples( Numerotation * num ){
+	initialiser_numerotation(
+		num,
+		( int(*)(const intptr_t, const intptr_t) ) comparer_couple,
+		( intptr_t (*)( const intptr_t ) ) copier_couple,
+		( void(*)(intptr_t) ) supprimer_couple
+	);
+}
+
+/*
+ * Les couples d'états de deux automates sont codés par un entier, à partir de
+ * leurs indices denses : (p, q) devient indice(p) * n + indice(q), n étant le
+ * nombre d'états du second automate. Les clés n'ont ni à être allouées, ni à
+ * être comparées champ par champ.
+ */
+void initialiser_numerotation_couples_d_etats(
+	Numerotation * num, const Automate * premier, const Automate * second
+){
+	initialiser_numerotation( num, NULL, NULL, NULL );
+	num->premier = premier;
+	num->second = second;
+}
+
+void initialiser_numerotation_ensembles( Numerotation * num ){
+	initialiser_numerotation(
+		num,
+		( int(*)(const intptr_t, const intptr_t) ) comparer_ensemble,
+		( intptr_t (*)( const intptr_t ) ) copier_ensemble,
+		( void(*)(intptr_t) ) liberer_ensemble
+	);
+}
+
+void liberer_numerotation( Numerotation * num ){
+	while( ! est_vide( num->a_traiter ) ){
+		intptr_t cle = retirer_fifo( num->a_traiter );
+		if( num->supprimer_cle ) num->supprimer_cle( cle );
+	}
+	liberer_fifo( num->a_traiter );
+	liberer_table( num->numeros );
+}
+
+/*
+ * Renvoie le numéro associé à la clé. Si la clé n'a encore jamais été
+ * rencontrée, un nouveau numéro lui est attribué et une copie de la clé est
+ * ajoutée aux clés à traiter.
+ */
+int numero_de_la_cle( Numerotation * num, const intptr_t cle ){
+	Table_iterateur it = trouver_table( num->numeros, cle );
+	if( ! iterateur_est_vide( it ) ){
+		return get_valeur( it );
+	}
+	int numero = num->nb_etats++;
+	add_table( num->numeros, cle, numero );
+	ajouter_fifo(
+		num->a_traiter, num->copier_cle ? num->copier_cle( cle ) : cle
+	);
+	return numero;
+}
+
+int numero_du_couple( Numerotation * num, int premier, int second ){
+	Couple couple;
+	couple.premier = premier;
+	couple.second = second;
+	return numero_de_la_cle( num, (intptr_t) &couple );
+}
+
+int numero_du_couple_d_etats( Numerotation * num, int premier, int second ){
+	intptr_t cle =
+		(intptr_t) indice_de_l_etat( num->premier, premier )
+		* taille_ensemble( get_etats( num->second ) )
+		+ indice_de_l_etat( num->second, second );
+	return numero_de_la_cle( num, cle );
+}
+
+/*
+ * Retire de la file la clé suivante d'un couple d'états et la décode.
+ */
+Couple retirer_couple_d_etats( Numerotation * num ){
+	intptr_t cle = retirer_fifo( num->a_traiter );
+	int nb_seconds = taille_ensemble( get_etats( num->second ) );
+	Couple couple;
+	couple.premier = etat_de_l_indice( num->premier, cle / nb_seconds );
+	couple.second = etat_de_l_indice( num->second, cle % nb_seconds );
+	return couple;
+}
+
+/*/
+ * Le mélange lit chaque lettre soit dans le premier automate, soit dans le
+ * second : depuis le couple (p, q), une transition (p, a, p') du premier
+ * automate donne ((p, q), a, (p', q)) et une transition (q, a, q') du second
+ * donne ((p, q), a, (p, q')).
+/*/
+void ajouter_transitions_melange(
+	Automate * melange, Numerotation * num, int etat, const Couple * couple,
+	const Automate * automate, int lire_le_premier
+){
+	Ensemble_iterateur it_lettre, it_fin;
+	for(
+		it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
+		! iterateur_ensemble_est_vide( it_lettre );
+		it_lettre = iterateur_suivant_ensemble( it_lettre )
+	){
+		char lettre = (char) get_element( it_lettre );
+		const Ensemble * fins = voisins(
+			automate,
+			lire_le_premier ? couple->premier : couple->second,
+			lettre
+		);
+		for(
+			it_fin = premier_iterateur_ensemble( fins );
+			! iterateur_ensemble_est_vide( it_fin );
+			it_fin = iterateur_suivant_ensemble( it_fin )
+		){
+			int fin = get_element( it_fin );
+			int arrivee = lire_le_premier ?
+				numero_du_couple_d_etats( num, fin, couple->second ) :
+				numero_du_couple_d_etats( num, couple->premier, fin );
+			ajouter_transition( melange, etat, lettre, arrivee );
+		}
+	}
+}
+
+Automate * creer_melange_des_vues( Vue_automate vue_1, Vue_automate vue_2 ){
+	// La translation des vues ne change que les numéros des états lus : on
+	// travaille directement sur les automates des vues.
+	const Automate * automate_1 = vue_1.automate;
+	const Automate * automate_2 = vue_2.automate;
+	Automate * melange = creer_automate();
+	Numerotation num;
+	initialiser_numerotation_couples_d_etats( &num, automate_1, automate_2 );
+
+	ajouter_lettres( melange, get_alphabet( automate_1 ) );
+	ajouter_lettres( melange, get_alphabet( automate_2 ) );
+
+	Ensemble_iterateur it1, it2;
+	for(
+		it1 = premier_iterateur_ensemble( get_initiaux( automate_1 ) );
+		! iterateur_ensemble_est_vide( it1 );
+		it1 = iterateur_suivant_ensemble( it1 )
+	){
+		for(
+			it2 = premier_iterateur_ensemble( get_initiaux( automate_2 ) );
+			! iterateur_ensemble_est_vide( it2 );
+			it2 = iterateur_suivant_ensemble( it2 )
+		){
+			ajouter_etat_initial(
+				melange,
+				numero_du_couple_d_etats(
+					&num, get_element( it1 ), get_element( it2 )
+				)
+			);
+		}
+	}
+
+	while( ! est_vide( num.a_traiter ) ){
+		Couple couple = retirer_couple_d_etats( &num );
+		int etat = numero_du_couple_d_etats(
+			&num, couple.premier, couple.second
+		);
+		ajouter_etat( melange, etat );
+
+		if(
+			est_un_etat_final_de_l_automate( automate_1, couple.premier ) &&
+			est_un_etat_final_de_l_automate( automate_2, couple.second )
+		){
+			ajouter_etat_final( melange, etat );
+		}
+		ajouter_transitions_melange(
+			melange, &num, etat, &couple, automate_1, 1
+		);
+		ajouter_transitions_melange(
+			melange, &num, etat, &couple, automate_2, 0
+		);
+	}
+
+	liberer_numerotation( &num );
+	return melange;
+}
+
+Automate * creer_automate_du_melange(
+	const Automate* automate_1,  const Automate* automate_2
+){
+	return creer_melange_des_vues(
+		vue_automate( automate_1, 0 ), vue_automate( automate_2, 0 )
+	);
+}
+
+/*/
+ * L'automate produit lit chaque lettre dans les deux automates à la fois :
+ * depuis le couple (p, q), les transitions (p, a, p') et (q, a, q') donnent
+ * ((p, q), a, (p', q')). Seules les lettres communes aux deux alphabets
+ * peuvent donc être lues.
+/*/
+Automate * creer_intersection_des_automates(
+	const Automate * automate_1, const Automate * automate_2
+){
+	Automate * produit = creer_automate();
+	Numerotation num;
+	initialiser_numerotation_couples_d_etats( &num, automate_1, automate_2 );
+
+	Ensemble * alphabet = creer_intersection_ensemble(
+		get_alphabet( automate_1 ), get_alphabet( automate_2 )
+	);
+	ajouter_lettres( produit, alphabet );
+
+	Ensemble_iterateur it1, it2;
+	for(
+		it1 = premier_iterateur_ensemble( get_initiaux( automate_1 ) );
+		! iterateur_ensemble_est_vide( it1 );
+		it1 = iterateur_suivant_ensemble( it1 )
+	){
+		for(
+			it2 = premier_iterateur_ensemble( get_initiaux( automate_2 ) );
+			! iterateur_ensemble_est_vide( it2 );
+			it2 = iterateur_suivant_ensemble( it2 )
+		){
+			ajouter_etat_initial(
+				produit,
+				numero_du_couple_d_etats(
+					&num, get_element( it1 ), get_element( it2 )
+				)
+			);
+		}
+	}
+
+	while( ! est_vide( num.a_traiter ) ){
+		Couple couple = retirer_couple_d_etats( &num );
+		int etat = numero_du_couple_d_etats(
+			&num, couple.premier, couple.second
+		);
+		ajouter_etat( produit, etat );
+
+		if(
+			est_un_etat_final_de_l_automate( automate_1, couple.premier ) &&
+			est_un_etat_final_de_l_automate( automate_2, couple.second )
+		){
+			ajouter_etat_final( produit, etat );
+		}
+
+		Ensemble_iterateur it_lettre;
+		for(
+			it_lettre = premier_iterateur_ensemble( alphabet );
+			! iterateur_ensemble_est_vide( it_lettre );
+			it_lettre = iterateur_suivant_ensemble( it_lettre )
+		){
+			char lettre = (char) get_element( it_lettre );
+			const Ensemble * fins_1 = voisins( automate_1, couple.premier, lettre );
+			if( taille_ensemble( fins_1 ) == 0 ) continue;
+			const Ensemble * fins_2 = voisins( automate_2, couple.second, lettre );
+			for(
+				it1 = premier_iterateur_ensemble( fins_1 );
+				! iterateur_ensemble_est_vide( it1 );
+				it1 = iterateur_suivant_ensemble( it1 )
+			){
+				for(
+					it2 = premier_iterateur_ensemble( fins_2 );
+					! iterateur_ensemble_est_vide( it2 );
+					it2 = iterateur_suivant_ensemble( it2 )
+				){
+					ajouter_transition(
+						produit, etat, lettre,
+						numero_du_couple_d_etats(
+							&num, get_element( it1 ), get_element( it2 )
+						)
+					);
+				}
+			}
+		}
+	}
+
+	liberer_ensemble( alphabet );
+	liberer_numerotation( &num );
+	return produit;
+}
+
+/*/
+ * Lire le mot dans l'automate produit revient à le lire en parallèle dans les
+ * deux automates : l'ensemble des couples courants est exactement le produit
+ * des deux ensembles courants. Les garder séparés évite de construire ce
+ * produit, et permet d'abandonner dès que l'un des deux est vide.
+/*/
+int contient_un_etat_final( const Automate * automate, const Ensemble * etats ){
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( etats );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		if( est_un_etat_final_de_l_automate( automate, get_element( it ) ) ){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int le_mot_est_reconnu_par_l_intersection(
+	const Automate * automate_1, const Automate * automate_2, const char * mot
+){
+	Ensemble * courants_1 = copier_ensemble( get_initiaux( automate_1 ) );
+	Ensemble * courants_2 = copier_ensemble( get_initiaux( automate_2 ) );
+	int i;
+	for(
+		i=0;
+		mot[i] != '\0'
+			&& taille_ensemble( courants_1 ) != 0
+			&& taille_ensemble( courants_2 ) != 0;
+		i++
+	){
+		Ensemble * tmp = delta( automate_1, courants_1, mot[i] );
+		liberer_ensemble( courants_1 );
+		courants_1 = tmp;
+		tmp = delta( automate_2, courants_2, mot[i] );
+		liberer_ensemble( courants_2 );
+		courants_2 = tmp;
+	}
+	int result =
+		mot[i] == '\0'
+		&& contient_un_etat_final( automate_1, courants_1 )
+		&& contient_un_etat_final( automate_2, courants_2 );
+	liberer_ensemble( courants_1 );
+	liberer_ensemble( courants_2 );
+	return result;
+}
+
+/*/
+ * determiniser applique la construction des sous-ensembles : chaque état de
+ * l'automate déterministe est un ensemble non vide d'états de l'automate de
+ * départ, numéroté la première fois qu'il est atteint.
+ *
+ * L'alphabet est passé en paramètre pour permettre à complementer de
+ * compléter l'automate sur un alphabet plus grand que le sien.
+/*/
+Automate * determiniser_sur_alphabet(
+	const Automate * automate, const Ensemble * alphabet
+){
+	Automate * res = creer_automate();
+	Numerotation num;
+	initialiser_numerotation_ensembles( &num );
+
+	ajouter_lettres( res, alphabet );
+
+	if( taille_ensemble( get_initiaux( automate ) ) != 0 ){
+		ajouter_etat_initial(
+			res, numero_de_la_cle( &num, (intptr_t) get_initiaux( automate ) )
+		);
+	}
+
+	while( ! est_vide( num.a_traiter ) ){
+		Ensemble * courants = (Ensemble*) retirer_fifo( num.a_traiter );
+		int etat = numero_de_la_cle( &num, (intptr_t) courants );
+		ajouter_etat( res, etat );
+
+		if( contient_un_etat_final( automate, courants ) ){
+			ajouter_etat_final( res, etat );
+		}
+
+		Ensemble_iterateur it;
+		for(
+			it = premier_iterateur_ensemble( alphabet );
+			! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
+		){
+			char lettre = (char) get_element( it );
+			Ensemble * suivants = delta( automate, courants, lettre );
+			if( taille_ensemble( suivants ) != 0 ){
+				ajouter_transition(
+					res, etat, lettre,
+					numero_de_la_cle( &num, (intptr_t) suivants )
+				);
+			}
+			liberer_ensemble( suivants );
+		}
+		liberer_ensemble( courants );
+	}
+
+	liberer_numerotation( &num );
+	return res;
+}
+
+Automate * determiniser( const Automate * automate ){
+	return determiniser_sur_alphabet( automate, get_alphabet( automate ) );
+}
+
+/*/
+ * Dans l'automate déterminisé, une transition absente mène à l'ensemble
+ * vide, qui n'est jamais final : dans le complémentaire, elle doit mener à
+ * un état final qui boucle sur toutes les lettres. Cet état est l'état puits
+ * implicite de l'automate, ce qui évite de stocker |états| x |alphabet|
+ * transitions supplémentaires.
+/*/
+Automate * complementer_sur_alphabet(
+	const Automate * automate, const Ensemble * alphabet
+){
+	Automate * res = determiniser_sur_alphabet( automate, alphabet );
+
+	Ensemble * finaux = creer_difference_ensemble(
+		get_etats( res ), get_finaux( res )
+	);
+	invalider_caches( res );
+	ecrire_composante( res, COMPOSANTE_FINAUX );
+	deplacer_ensemble( res->finaux, finaux );
+
+	// Les états sont numérotés à partir de 0 : le puits est le suivant.
+	int puits = taille_ensemble( get_etats( res ) );
+	fixer_etat_puits( res, puits );
+	ajouter_etat_final( res, puits );
+
+	// Sans état initial, aucun mot n'était reconnu : tous le sont désormais.
+	if( taille_ensemble( get_initiaux( res ) ) == 0 ){
+		ajouter_etat_initial( res, puits );
+	}
+
+	return res;
+}
+
+Automate * complementer( const Automate * automate ){
+	return complementer_sur_alphabet( automate, get_alphabet( automate ) );
+}
+
+Automate * difference(
+	const Automate * automate_1, const Automate * automate_2
+){
+	Ensemble * alphabet = creer_union_ensemble(
+		get_alphabet( automate_1 ), get_alphabet( automate_2 )
+	);
+	Automate * complementaire = complementer_sur_alphabet( automate_2, alphabet );
+	Automate * res = creer_intersection_des_automates( automate_1, complementaire );
+	liberer_automate( complementaire );
+	liberer_ensemble( alphabet );
+	return res;
+}
+
+/*/
+ * Sous_ensembles numérote les états d'un automate déterminisé à la volée :
+ * le numéro i désigne l'ensemble d'états ensembles[i] de l'automate, et
+ * finaux[i] indique si cet ensemble contient un état final.
+ * Contrairement à determiniser, l'ensemble vide est un état comme un autre.
+/*/
+typedef struct {
+	const Automate * automate;
+	Table * numeros;       // Ensemble -> numéro, clés possédées par 'ensembles'
+	Ensemble ** ensembles;
+	char * finaux;
+	int nb;
+	int capacite;
+} Sous_ensembles;
+
+void initialiser_sous_ensembles( Sous_ensembles * se, const Automate * automate ){
+	se->automate = automate;
+	se->numeros = creer_table(
+		( int(*)(const intptr_t, const intptr_t) ) comparer_ensemble, NULL, NULL
+	);
+	se->nb = 0;
+	se->capacite = 16;
+	se->ensembles = xmalloc( se->capacite * sizeof(Ensemble*) );
+	se->finaux = xmalloc( se->capacite * sizeof(char) );
+}
+
+void liberer_sous_ensembles( Sous_ensembles * se ){
+	int i;
+	liberer_table( se->numeros );
+	for( i=0; i<se->nb; i++ ){
+		liberer_ensemble( se->ensembles[i] );
+	}
+	xfree( se->ensembles );
+	xfree( se->finaux );
+}
+
+/*
+ * Renvoie le numéro de l'ensemble d'états, qui est pris en charge par
+ * 'se' (et libéré s'il était déjà numéroté).
+ */
+int numero_du_sous_ensemble( Sous_ensembles * se, Ensemble * ens ){
+	Table_iterateur it = trouver_table( se->numeros, (intptr_t) ens );
+	if( ! iterateur_est_vide( it ) ){
+		liberer_ensemble( ens );
+		return get_valeur( it );
+	}
+	if( se->nb == se->capacite ){
+		se->capacite *= 2;
+		se->ensembles = xrealloc( se->ensembles, se->capacite * sizeof(Ensemble*) );
+		se->finaux = xrealloc( se->finaux, se->capacite * sizeof(char) );
+	}
+	int numero = se->nb++;
+	se->ensembles[numero] = ens;
+	se->finaux[numero] = contient_un_etat_final( se->automate, ens );
+	add_table( se->numeros, (intptr_t) ens, numero );
+	return numero;
+}
+
+/*/
+ * File_de_paires est une file de paires qui retient, pour chaque paire, la
+ * paire depuis laquelle elle a été atteinte et la lettre lue : on peut ainsi
+ * reconstruire le mot qui mène à n'importe quelle paire de la file.
+ * Les paires étant traitées dans l'ordre de la file (parcours en largeur),
+ * ce mot est l'un des plus courts.
+/*/
+typedef struct {
+	intptr_t * premier;
+	intptr_t * second;
+	int * parent;
+	char * lettre;
+	int nb;
+	int capacite;
+} File_de_paires;
+
+void initialiser_file_de_paires( File_de_paires * file ){
+	file->nb = 0;
+	file->capacite = 16;
+	file->premier = xmalloc( file->capacite * sizeof(intptr_t) );
+	file->second = xmalloc( file->capacite * sizeof(intptr_t) );
+	file->parent = xmalloc( file->capacite * sizeof(int) );
+	file->lettre = xmalloc( file->capacite * sizeof(char) );
+}
+
+void liberer_file_de_paires( File_de_paires * file ){
+	xfree( file->premier );
+	xfree( file->second );
+	xfree( file->parent );
+	xfree( file->lettre );
+}
+
+int ajouter_paire(
+	File_de_paires * file, intptr_t premier, intptr_t second,
+	int parent, char lettre
+){
+	if( file->nb == file->capacite ){
+		file->capacite *= 2;
+		file->premier = xrealloc( file->premier, file->capacite * sizeof(intptr_t) );
+		file->second = xrealloc( file->second, file->capacite * sizeof(intptr_t) );
+		file->parent = xrealloc( file->parent, file->capacite * sizeof(int) );
+		file->lettre = xrealloc( file->lettre, file->capacite * sizeof(char) );
+	}
+	file->premier[file->nb] = premier;
+	file->second[file->nb] = second;
+	file->parent[file->nb] = parent;
+	file->lettre[file->nb] = lettre;
+	return file->nb++;
+}
+
+char * mot_de_la_paire( const File_de_paires * file, int paire ){
+	int longueur = 0;
+	int i;
+	for( i = paire; file->parent[i] >= 0; i = file->parent[i] ) longueur++;
+	char * mot = xmalloc( longueur + 1 );
+	mot[longueur] = '\0';
+	for( i = paire; file->parent[i] >= 0; i = file->parent[i] ){
+		mot[--longueur] = file->lettre[i];
+	}
+	return mot;
+}
+
+/*/
+ * Partition est une structure union-find sur les entiers positifs, agrandie
+ * à la demande.
+/*/
+typedef struct {
+	int * parent;
+	int capacite;
+} Partition;
+
+void initialiser_partition( Partition * partition ){
+	partition->capacite = 0;
+	partition->parent = NULL;
 }
 
-int est_un_etat_initial_de_l_automate( const Automate* automate, int etat ){
-	return est_dans_l_ensemble( get_initiaux( automate ), etat );
+void liberer_partition( Partition * partition ){
+	xfree( partition->parent );
 }
 
-int est_un_etat_final_de_l_automate( const Automate* automate, int etat ){
-	return est_dans_l_ensemble( get_finaux( automate ), etat );
+int trouver_representant( Partition * partition, int x ){
+	if( x >= partition->capacite ){
+		int capacite = 2 * x + 16;
+		int i;
+		partition->parent = xrealloc( partition->parent, capacite * sizeof(int) );
+		for( i=partition->capacite; i<capacite; i++ ){
+			partition->parent[i] = i;
+		}
+		partition->capacite = capacite;
+	}
+	while( partition->parent[x] != x ){
+		partition->parent[x] = partition->parent[ partition->parent[x] ];
+		x = partition->parent[x];
+	}
+	return x;
 }
 
-int est_une_lettre_de_l_automate( const Automate* automate, char lettre ){
-	return est_dans_l_ensemble( get_alphabet( automate ), lettre );
+/*
+ * Réunit les classes de x et y. Renvoie 0 si elles étaient déjà réunies.
+ */
+int unir( Partition * partition, int x, int y ){
+	x = trouver_representant( partition, x );
+	y = trouver_representant( partition, y );
+	if( x == y ) return 0;
+	partition->parent[x] = y;
+	return 1;
 }
 
-void print_ensemble_2( const intptr_t ens ){
-	print_ensemble( (Ensemble*) ens, NULL );
+/*/
+ * sont_equivalents : les états déterministes du premier automate sont
+ * numérotés 2i et ceux du second 2j+1 dans la partition, ce qui évite de
+ * construire l'union des deux automates.
+/*/
+int sont_equivalents(
+	const Automate * automate_1, const Automate * automate_2,
+	char ** contre_exemple
+){
+	Sous_ensembles se_1, se_2;
+	initialiser_sous_ensembles( &se_1, automate_1 );
+	initialiser_sous_ensembles( &se_2, automate_2 );
+	Partition partition;
+	initialiser_partition( &partition );
+	File_de_paires file;
+	initialiser_file_de_paires( &file );
+	Ensemble * alphabet = creer_union_ensemble(
+		get_alphabet( automate_1 ), get_alphabet( automate_2 )
+	);
+
+	int x = numero_du_sous_ensemble(
+		&se_1, copier_ensemble( get_initiaux( automate_1 ) )
+	);
+	int y = numero_du_sous_ensemble(
+		&se_2, copier_ensemble( get_initiaux( automate_2 ) )
+	);
+	int paire = ajouter_paire( &file, x, y, -1, '\0' );
+	unir( &partition, 2*x, 2*y+1 );
+	int different = se_1.finaux[x] != se_2.finaux[y];
+
+	int tete;
+	for( tete = 0; ! different && tete < file.nb; tete++ ){
+		Ensemble_iterateur it;
+		for(
+			it = premier_iterateur_ensemble( alphabet );
+			! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
+		){
+			char lettre = (char) get_element( it );
+			x = numero_du_sous_ensemble(
+				&se_1,
+				delta( automate_1, se_1.ensembles[ file.premier[tete] ], lettre )
+			);
+			y = numero_du_sous_ensemble(
+				&se_2,
+				delta( automate_2, se_2.ensembles[ file.second[tete] ], lettre )
+			);
+			if( unir( &partition, 2*x, 2*y+1 ) ){
+				paire = ajouter_paire( &file, x, y, tete, lettre );
+				if( se_1.finaux[x] != se_2.finaux[y] ){
+					different = 1;
+					break;
+				}
+			}
+		}
+	}
+
+	if( contre_exemple ){
+		*contre_exemple = different ? mot_de_la_paire( &file, paire ) : NULL;
+	}
+
+	liberer_ensemble( alphabet );
+	liberer_file_de_paires( &file );
+	liberer_partition( &partition );
+	liberer_sous_ensembles( &se_1 );
+	liberer_sous_ensembles( &se_2 );
+	return ! different;
 }
 
-void print_lettre( intptr_t c ){
-	printf("%c", (char) c );
+/*/
+ * est_inclus explore les couples (p, S) où p est un état du premier automate
+ * et S l'ensemble des états du second atteints par le même mot. Un
+ * contre-exemple est un couple où p est final et S ne contient aucun état
+ * final.
+ *
+ * Les couples déjà explorés sont chaînés par état p (table 'premiers' vers
+ * le dernier couple de p, tableau 'suivants' vers le couple précédent de p)
+ * pour tester rapidement si un nouveau couple est couvert par l'antichaîne.
+/*/
+int est_couvert(
+	const File_de_paires * file, const int * suivants, const Table * premiers,
+	int p, const Ensemble * ens
+){
+	Table_iterateur it = trouver_table( premiers, p );
+	if( iterateur_est_vide( it ) ) return 0;
+	int i;
+	for( i = get_valeur( it ); i >= 0; i = suivants[i] ){
+		if( est_un_sous_ensemble( (const Ensemble*) file->second[i], ens ) ){
+			return 1;
+		}
+	}
+	return 0;
 }
 
-void print_automate( const Automate * automate ){
-	printf("- Etats : ");
-	print_ensemble( get_etats( automate ), NULL );
-	printf("\n- Initiaux : ");
-	print_ensemble( get_initiaux( automate ), NULL );
-	printf("\n- Finaux : ");
-	print_ensemble( get_finaux( automate ), NULL );
-	printf("\n- Alphabet : ");
-	print_ensemble( get_alphabet( automate ), print_lettre );
-	printf("\n- Transitions : ");
-	print_table( 
-		automate->transitions,
-		( void (*)( const intptr_t ) ) print_cle, 
-		( void (*)( const intptr_t ) ) print_ensemble_2,
-		""
-	);
-	printf("\n");
+/*
+ * Ajoute le couple (p, ens) s'il n'est pas couvert, et renvoie sa position
+ * dans la file, ou -1 s'il est couvert (auquel cas 'ens' est libéré).
+ */
+int ajouter_couple_inclusion(
+	File_de_paires * file, int ** suivants, Table * premiers,
+	int p, Ensemble * ens, int parent, char lettre
+){
+	if( est_couvert( file, *suivants, premiers, p, ens ) ){
+		liberer_ensemble( ens );
+		return -1;
+	}
+	int capacite = file->capacite;
+	int i = ajouter_paire( file, p, (intptr_t) ens, parent, lettre );
+	if( file->capacite != capacite ){
+		*suivants = xrealloc( *suivants, file->capacite * sizeof(int) );
+	}
+	Table_iterateur it = trouver_table( premiers, p );
+	(*suivants)[i] = iterateur_est_vide( it ) ? -1 : get_valeur( it );
+	add_table( premiers, p, i );
+	return i;
 }
 
-int le_mot_est_reconnu( const Automate* automate, const char* mot ){
-	Ensemble * arrivee = delta_star( automate, get_initiaux(automate) , mot ); 
-	
-	int result = 0;
+int est_inclus(
+	const Automate * automate_1, const Automate * automate_2,
+	char ** contre_exemple
+){
+	File_de_paires file;
+	initialiser_file_de_paires( &file );
+	int * suivants = xmalloc( file.capacite * sizeof(int) );
+	Table * premiers = creer_table( NULL, NULL, NULL );
+	int trouve = -1;
 
 	Ensemble_iterateur it;
 	for(
-		it = premier_iterateur_ensemble( arrivee );
+		it = premier_iterateur_ensemble( get_initiaux( automate_1 ) );
 		! iterateur_ensemble_est_vide( it );
 		it = iterateur_suivant_ensemble( it )
 	){
-		if( est_un_etat_final_de_l_automate( automate, get_element(it) ) ){
-			result = 1;
+		ajouter_couple_inclusion(
+			&file, &suivants, premiers, get_element( it ),
+			copier_ensemble( get_initiaux( automate_2 ) ), -1, '\0'
+		);
+	}
+
+	int tete;
+	for( tete = 0; trouve < 0 && tete < file.nb; tete++ ){
+		int p = file.premier[tete];
+		const Ensemble * ens = (const Ensemble*) file.second[tete];
+		if(
+			est_un_etat_final_de_l_automate( automate_1, p )
+			&& ! contient_un_etat_final( automate_2, ens )
+		){
+			trouve = tete;
 			break;
 		}
+
+		Ensemble_iterateur it_lettre, it_fin;
+		for(
+			it_lettre = premier_iterateur_ensemble( get_alphabet( automate_1 ) );
+			! iterateur_ensemble_est_vide( it_lettre );
+			it_lettre = iterateur_suivant_ensemble( it_lettre )
+		){
+			char lettre = (char) get_element( it_lettre );
+			const Ensemble * fins = voisins( automate_1, p, lettre );
+			if( taille_ensemble( fins ) == 0 ) continue;
+			Ensemble * suivant = delta( automate_2, ens, lettre );
+			for(
+				it_fin = premier_iterateur_ensemble( fins );
+				! iterateur_ensemble_est_vide( it_fin );
+				it_fin = iterateur_suivant_ensemble( it_fin )
+			){
+				ajouter_couple_inclusion(
+					&file, &suivants, premiers, get_element( it_fin ),
+					copier_ensemble( suivant ), tete, lettre
+				);
+			}
+			liberer_ensemble( suivant );
+		}
 	}
-	liberer_ensemble( arrivee );
-	return result;
-}
 
-Automate * mot_to_automate( const char * mot ){
-	Automate * automate = creer_automate();
-	int i = 0;
-	int size = strlen( mot );
-	for( i=0; i < size; i++ ){
-		ajouter_transition( automate, i, mot[i], i+1 );
+	if( contre_exemple ){
+		*contre_exemple = trouve >= 0 ? mot_de_la_paire( &file, trouve ) : NULL;
 	}
-	ajouter_etat_initial( automate, 0 );
-	ajouter_etat_final( automate, size );
-	return automate;
-}
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////
-// PROJET D'INFORMATIQUE THÉORIQUE 2015-2016                                                         //
-//                                                                                                   //
-// Fonctions à implémenter :                                                                         //
-// int get_max_etat( const Automate* automate );                                                     //
-// Automate * creer_union_des_automates( const Automate * automate_1, const Automate * automate_2 ); //
-// Ensemble* etats_accessibles( const Automate * automate, int etat );                               //
-// Ensemble* accessibles( const Automate * automate );                                               //
-// Automate *automate_accessible( const Automate * automate );                                       //
-// Automate *miroir( const Automate * automate);                                                     //
-// Automate * creer_automate_du_melange( const Automate* automate_1,  const Automate* automate_2 );  //
-//                                                                                                   //
-// Notes :                                                                                           //
-// Les fonctionnalités sont purement implémentées : ne sachant quelle utilisation est censée en être //
-// faite, il a été choisi de respecter strictement la demande. Par exemple, la fonction miroir ne    //
-// cherche pas à supprimer les états inaccessibles. Les optimisations sont laissées à l'utilisateur. //
-// Aucun zèle.                                                                                       //
-// De plus, puisque nous sommes dans le module-même, nous conservons le droit d'accéder directement  //
-// aux champs de la structure Automate si ceux-ci clarifient le code.                                //
-///////////////////////////////////////////////////////////////////////////////////////////////////////
+	int i;
+	for( i=0; i<file.nb; i++ ){
+		liberer_ensemble( (Ensemble*) file.second[i] );
+	}
+	liberer_table( premiers );
+	xfree( suivants );
+	liberer_file_de_paires( &file );
+	return trouve < 0;
+}
 
 /*/
- * get_max_etat retourne l'etat ayant l'étiquette la plus grande.
- * Les etats sont supposés avoir des valeurs positives ou nulles.
- * Cette fonction est, sans surprise, largement inspirée de get_min_etat.
+ * Graphe est une copie compacte des transitions d'un automate, utilisée par
+ * les parcours en largeur : les états sont numérotés par leurs indices
+ * denses (voir indice_de_l_etat()), et les transitions issues de l'état
+ * numéro i (ou arrivant dans l'état numéro i pour un graphe inversé)
+ * occupent les cases debut[i] à debut[i+1]-1 des tableaux 'voisin' et
+ * 'lettre', par lettre croissante.
+ *
+ * Le graphe inversé est l'index des prédécesseurs (voir
+ * creer_predecesseurs()), dont les origines sont remplacées par leurs
+ * numéros : il n'y a qu'une construction des transitions à rebours.
+ *
+ * La construction fait deux passes sur les transitions et lit un indice
+ * dense par extrémité : elle est en O(|Q|+|δ|) quand les indices sont lus
+ * dans le tableau direct de l'automate, en O((|Q|+|δ|) log |Q|) pour des
+ * états épars (voir indice_de_l_etat()). Un parcours coûte ensuite
+ * O(|Q|+|δ|).
 /*/
-void action_get_max_etat( const intptr_t element, void* data ){
-	int * max = (int*) data;
-	if( *max < element ) *max = element;
+typedef struct {
+	const Automate * automate;
+	int nb_etats;
+	const int * etats;  // numéro -> état, lu dans l'automate
+	int * debut;
+	int * voisin;
+	char * lettre;
+} Graphe;
+
+typedef struct {
+	Graphe * graphe;
+	int * places;
+} Donnees_graphe;
+
+int numero_de_l_etat( const Graphe * graphe, int etat ){
+	return indice_de_l_etat( graphe->automate, etat );
 }
 
-int get_max_etat( const Automate* automate ){
-	int max = INT_MIN;
-
-	pour_tout_element( automate->etats, action_get_max_etat, &max );
-
-	return max;
+void action_compter_transitions_graphe(
+	int origine, char lettre, int fin, void* data
+){
+	Graphe * graphe = ((Donnees_graphe*) data)->graphe;
+	graphe->debut[ numero_de_l_etat( graphe, origine ) + 1 ]++;
 }
 
-/*/
- * miroir renvoie un automate décrivant l'automate miroir de celui
- * donné en paramètre.
- *
- * miroir_action est une fonction auxiliare inversant le sens des transitions.
-/*/
-void miroir_action( int origine, char lettre, int fin, void* data ){
-	Automate * nouvel_automate = (Automate*) data;
-
-	ajouter_transition( nouvel_automate, fin, lettre, origine );
+void action_placer_transitions_graphe(
+	int origine, char lettre, int fin, void* data
+){
+	Donnees_graphe * d = (Donnees_graphe*) data;
+	Graphe * graphe = d->graphe;
+	int depart = numero_de_l_etat( graphe, origine );
+	int arrivee = numero_de_l_etat( graphe, fin );
+	int place = d->places[depart]++;
+	graphe->voisin[place] = arrivee;
+	graphe->lettre[place] = lettre;
 }
 
-Automate *miroir( const Automate * automate){
-	Automate * nouvel_automate = creer_automate();
+void initialiser_graphe(
+	Graphe * graphe, const Automate * automate, int inverse
+){
+	int i;
+	graphe->automate = automate;
+	graphe->nb_etats = taille_ensemble( get_etats( automate ) );
+	graphe->etats = automate->etats_par_indice;
+
+	if( inverse ){
+		// Les tableaux de l'index passent au graphe.
+		Predecesseurs * predecesseurs = creer_predecesseurs( automate );
+		graphe->debut = predecesseurs->debut;
+		graphe->lettre = (char*) predecesseurs->lettre;
+		graphe->voisin = predecesseurs->origine;
+		xfree( predecesseurs );
+		for( i=0; i<graphe->debut[ graphe->nb_etats ]; i++ ){
+			graphe->voisin[i] = numero_de_l_etat( graphe, graphe->voisin[i] );
+		}
+		return;
+	}
 
-	// Même alphabet et mêmes états
-	nouvel_automate->alphabet = copier_ensemble( get_alphabet(automate) );
-	nouvel_automate->etats = copier_ensemble( get_etats(automate) );
+	graphe->debut = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
 
-	// Mais états initiaux et finaux inversés
-	nouvel_automate->initiaux = copier_ensemble( get_finaux(automate) );
-	nouvel_automate->finaux = copier_ensemble( get_initiaux(automate) );
+	Donnees_graphe d;
+	d.graphe = graphe;
+	for( i=0; i<=graphe->nb_etats; i++ ) graphe->debut[i] = 0;
+	pour_toute_transition( automate, action_compter_transitions_graphe, &d );
+	for( i=0; i<graphe->nb_etats; i++ ){
+		graphe->debut[i+1] += graphe->debut[i];
+	}
 
-	// Ainsi que des transitions inversés également.
-	pour_toute_transition( automate, miroir_action, nouvel_automate );
+	int nb_transitions = graphe->debut[ graphe->nb_etats ];
+	graphe->voisin = xmalloc( ( nb_transitions + 1 ) * sizeof(int) );
+	graphe->lettre = xmalloc( ( nb_transitions + 1 ) * sizeof(char) );
+	d.places = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	for( i=0; i<graphe->nb_etats; i++ ) d.places[i] = graphe->debut[i];
+	// Les transitions, puits compris, sont passées en revue par origine puis
+	// par lettre : chaque bloc du graphe direct est rempli déjà trié.
+	pour_toute_transition( automate, action_placer_transitions_graphe, &d );
+	xfree( d.places );
+}
+
+void liberer_graphe( Graphe * graphe ){
+	xfree( graphe->debut );
+	xfree( graphe->voisin );
+	xfree( graphe->lettre );
+}
 
 /*
-	Table_iterateur it;
-	for(
-		it = premier_iterateur_table( automate->transitions );
-		! iterateur_est_vide( it );
-		it = iterateur_suivant_table( it )
-	){
-		Cle * cle = (Cle*) get_cle( it2 );
-		Ensemble * fins = (Ensemble*) get_valeur( it2 );
-		for(
-			it1 = premier_iterateur_ensemble( fins );
-			! iterateur_ensemble_est_vide( it1 );
-			it1 = iterateur_suivant_ensemble( it1 )
-		){
-			int fin = get_element( it1 );
-			ajouter_transition( res, cle->origine, cle->lettre, fin );
-		}
-	}
+ * Calcule, dans 'distances', la distance de chaque état du graphe à
+ * l'ensemble 'sources' (-1 pour les états non atteints).
+ */
+void distances_du_graphe(
+	const Graphe * graphe, const Ensemble * sources, int * distances
+){
+	int * file = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	int tete = 0, queue = 0;
+	int i;
+	for( i=0; i<graphe->nb_etats; i++ ) distances[i] = -1;
 
 	Ensemble_iterateur it;
 	for(
-		it = premier_iterateur_ensemble( ens );
-		!iterateur_ensemble_est_vide( it );
+		it = premier_iterateur_ensemble( sources );
+		! iterateur_ensemble_est_vide( it );
 		it = iterateur_suivant_ensemble( it )
 	){
-		lol;
-	}*/
+		int source = numero_de_l_etat( graphe, get_element( it ) );
+		distances[source] = 0;
+		file[queue++] = source;
+	}
 
-	return nouvel_automate;
+	while( tete < queue ){
+		int etat = file[tete++];
+		for( i = graphe->debut[etat]; i < graphe->debut[etat+1]; i++ ){
+			int voisin = graphe->voisin[i];
+			if( distances[voisin] < 0 ){
+				distances[voisin] = distances[etat] + 1;
+				file[queue++] = voisin;
+			}
+		}
+	}
+	xfree( file );
 }
 
 /*/
- * etats_accessibles retourne l'ensemble des etats pouvant être atteints depuis
- * l'état etat, quelles que soient les lettres nécessaires pour cela.
- * On utilise delta1 qui renvoie l'ensemble des etats accessibles avec une lettre
- * précise.
+ * plus_court_mot fait un parcours en largeur depuis les états initiaux. Les
+ * transitions de chaque état étant rangées par lettre croissante, le premier
+ * état final atteint l'est par le plus petit des plus courts mots.
 /*/
+char * plus_court_mot( const Automate * automate ){
+	Graphe graphe;
+	initialiser_graphe( &graphe, automate, 0 );
+	File_de_paires file;
+	initialiser_file_de_paires( &file );
+	char * vu = xmalloc( graphe.nb_etats + 1 );
+	int i, tete;
+	for( i=0; i<graphe.nb_etats; i++ ) vu[i] = 0;
 
-Ensemble* etats_accessibles( const Automate * automate, int etat ){
-	Ensemble * ensemble = creer_ensemble( NULL, NULL, NULL );
-
-	// Pour chaque lettre de l'alphabet...
 	Ensemble_iterateur it;
 	for(
-		it = premier_iterateur_ensemble( get_alphabet(automate) );
-		!iterateur_ensemble_est_vide( it );
+		it = premier_iterateur_ensemble( get_initiaux( automate ) );
+		! iterateur_ensemble_est_vide( it );
 		it = iterateur_suivant_ensemble( it )
 	){
-		// ...on sauvegarde les états voisins de notre état etat.
-		transferer_elements_et_libere( ensemble, delta1( automate, etat, (char) get_element(it) ) );
+		int etat = numero_de_l_etat( &graphe, get_element( it ) );
+		vu[etat] = 1;
+		ajouter_paire( &file, etat, 0, -1, '\0' );
 	}
-	
-	return ensemble;
+
+	char * mot = NULL;
+	for( tete = 0; tete < file.nb; tete++ ){
+		int etat = file.premier[tete];
+		if( est_un_etat_final_de_l_automate( automate, graphe.etats[etat] ) ){
+			mot = mot_de_la_paire( &file, tete );
+			break;
+		}
+		for( i = graphe.debut[etat]; i < graphe.debut[etat+1]; i++ ){
+			int voisin = graphe.voisin[i];
+			if( ! vu[voisin] ){
+				vu[voisin] = 1;
+				ajouter_paire( &file, voisin, 0, tete, graphe.lettre[i] );
+			}
+		}
+	}
+
+	xfree( vu );
+	liberer_file_de_paires( &file );
+	liberer_graphe( &graphe );
+	return mot;
 }
 
-/*/
- * accessibles retourne l'ensemble des états accessibles depuis les états
- * initiaux de l'automate, c'est-à-dire l'ensemble des états de cet automate,
- * privé de ses éventuels états inutiles puisqu'inaccessibles.
-/*/
-Ensemble* accessibles( const Automate * automate ){
-	Ensemble * ensemble = creer_ensemble( NULL, NULL, NULL );
+int est_vide_langage( const Automate * automate ){
+	if( taille_ensemble( get_finaux( automate ) ) == 0 ) return 1;
+	Graphe graphe;
+	initialiser_graphe( &graphe, automate, 0 );
+	int * distances = xmalloc( ( graphe.nb_etats + 1 ) * sizeof(int) );
+	distances_du_graphe( &graphe, get_initiaux( automate ), distances );
 
-	// Pour chaque état initial de l'automate...
+	int vide = 1;
 	Ensemble_iterateur it;
 	for(
-		it = premier_iterateur_ensemble( get_initiaux(automate) );
-		!iterateur_ensemble_est_vide( it );
+		it = premier_iterateur_ensemble( get_finaux( automate ) );
+		vide && ! iterateur_ensemble_est_vide( it );
 		it = iterateur_suivant_ensemble( it )
 	){
-		// ...on sauvegarde les états accessibles depuis cet état.
-		transferer_elements_et_libere( ensemble, etats_accessibles( automate, (int) get_element(it) ) );
+		vide = distances[ numero_de_l_etat( &graphe, get_element( it ) ) ] < 0;
 	}
 
-	return ensemble;
+	xfree( distances );
+	liberer_graphe( &graphe );
+	return vide;
 }
 
-/*/
- * automate_accessible retourne un automate reconnaissant le même langage
- * que l'automate en paramètre, mais allégé de ses états inutiles.
- *
- * "Inutiles" est un terme important car il ne s'agit pas que de ses états
- * inaccessibles, mais aussi des puits (états inaccessibles de l'automate
- * miroir). Ici, cette propriété n'est pas utilisée, mais de mon avis,
- * elle devrait l'être.
-/*/
-void automate_accessible_action( int origine, char lettre, int fin, void * data ){
-	Automate * nouvel_automate = (Automate*) data;
-
-	if ( est_un_etat_de_l_automate( nouvel_automate, origine ) && est_un_etat_de_l_automate( nouvel_automate, fin ) )
-		ajouter_transition( nouvel_automate, origine, lettre, fin );
+int * creer_distances_aux_etats_finaux( const Automate * automate ){
+	// Les numéros des états dans le graphe sont leurs indices denses.
+	Graphe graphe;
+	initialiser_graphe( &graphe, automate, 1 );
+	int * distances = xmalloc( ( graphe.nb_etats + 1 ) * sizeof(int) );
+	distances_du_graphe( &graphe, get_finaux( automate ), distances );
+	liberer_graphe( &graphe );
+	return distances;
 }
 
-Automate *automate_accessible( const Automate * automate ){
-	Ensemble * ensemble = accessibles( automate );
-
-	Automate * nouvel_automate = creer_automate();
-
-	// Comme dit dans la description, il ne faut garder que les états utiles.
-	nouvel_automate->etats = ensemble;
-
-	// L'alphabet est le même.
-	// Certes, il est possible que certaines lettres n'apparaissent plus
-	// dans l'automate final, cependant, le langage qu'il reconnaît ne
-	// change pas, donc son alphabet non plus.
-	nouvel_automate->alphabet = copier_ensemble( get_alphabet(automate) );
-
-	// On rajoute ensuite les états initiaux et finaux non supprimés.
-	nouvel_automate->initiaux = creer_intersection_ensemble( get_etats(nouvel_automate), get_initiaux(automate) );
-	nouvel_automate->finaux = creer_intersection_ensemble( get_etats(nouvel_automate), get_finaux(automate) );
-
-	// Ne restent plus que les transitions.
-	// On ne garde que celles ayant pour origine et fin un état conservé.
-	pour_toute_transition( automate, automate_accessible_action, nouvel_automate );
+const Ensemble * etats_co_accessibles( Automate * automate ){
+	if( ! automate->co_accessibles ){
+		Graphe graphe;
+		initialiser_graphe( &graphe, automate, 1 );
+		int * distances = xmalloc( ( graphe.nb_etats + 1 ) * sizeof(int) );
+		distances_du_graphe( &graphe, get_finaux( automate ), distances );
+
+		Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+		int i;
+		for( i=0; i<graphe.nb_etats; i++ ){
+			if( distances[i] >= 0 ){
+				ajouter_element( res, graphe.etats[i] );
+			}
+		}
+		xfree( distances );
+		liberer_graphe( &graphe );
 
-	return nouvel_automate;
+		automate->co_accessibles = res;
+	}
+	return automate->co_accessibles;
 }
 
 /*/
- * 
+ * classes_de_lettres raffine une partition de l'alphabet, état par état :
+ * après le passage par l'état q, deux lettres sont dans la même classe si
+ * elles l'étaient avant et si elles mènent de q au même ensemble d'états.
+ * Seuls les états origines d'au moins une transition peuvent séparer des
+ * lettres ; depuis les autres, toutes les lettres mènent à l'ensemble vide
+ * (ou au puits).
 /*/
-void creer_union_des_automates_action( int origine, char lettre, int fin, void * data ){
-	Automate * automate_final = (Automate*) data;
-
-	ajouter_transition( automate_final, origine, lettre, fin );
-}
-
-Automate * creer_union_des_automates( const Automate * automate_1, const Automate * automate_2 ){
-	Automate * nouvel_automate_1 = translater_automate( automate_1, automate_2 );
-	Automate * automate_final = creer_automate();
-
-	automate_final->etats = creer_union_ensemble( get_etats(nouvel_automate_1), get_etats(automate_2) );
-	automate_final->alphabet = creer_union_ensemble( get_alphabet(nouvel_automate_1), get_alphabet(automate_2) );
-	automate_final->initiaux = creer_union_ensemble( get_initiaux(nouvel_automate_1), get_initiaux(automate_2) );
-	automate_final->finaux = creer_union_ensemble( get_finaux(nouvel_automate_1), get_finaux(automate_2) );
+int classes_de_lettres( const Automate * automate, int * classes ){
+	int i;
+	int nb_classes = taille_ensemble( get_alphabet( automate ) ) > 0 ? 1 : 0;
+	for( i=0; i<NB_LETTRES; i++ ){
+		classes[i] = est_une_lettre_de_l_automate( automate, (char) i ) ? 0 : -1;
+	}
 
-	pour_toute_transition( nouvel_automate_1, creer_union_des_automates_action, automate_final );
-	pour_toute_transition( automate_2, creer_union_des_automates_action, automate_final );
+	Numerotation ensembles;
+	initialiser_numerotation_ensembles( &ensembles );
 
-	liberer_automate( nouvel_automate_1 );
+	// Les clés de la table étant rangées par origine, on passe chaque
+	// origine une seule fois.
+	Table_iterateur it;
+	int premiere = 1;
+	int origine_precedente = 0;
+	for(
+		it = premier_iterateur_table( automate->transitions );
+		! iterateur_est_vide( it );
+		it = iterateur_suivant_table( it )
+	){
+		int origine = ( (Cle*) get_cle( it ) )->origine;
+		if( ! premiere && origine == origine_precedente ) continue;
+		premiere = 0;
+		origine_precedente = origine;
+
+		Numerotation nouvelles;
+		initialiser_numerotation_couples( &nouvelles );
+		Ensemble_iterateur it_lettre;
+		for(
+			it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
+			! iterateur_ensemble_est_vide( it_lettre );
+			it_lettre = iterateur_suivant_ensemble( it_lettre )
+		){
+			int lettre = get_element( it_lettre );
+			int numero = numero_de_la_cle(
+				&ensembles, (intptr_t) voisins( automate, origine, (char) lettre )
+			);
+			classes[lettre] = numero_du_couple(
+				&nouvelles, classes[lettre], numero
+			);
+		}
+		nb_classes = nouvelles.nb_etats;
+		liberer_numerotation( &nouvelles );
+	}
 
-	return automate_final;
+	liberer_numerotation( &ensembles );
+	return nb_classes;
 }
-
-/*/
- * 
-/*/
-Automate * creer_automate_du_melange(
-	const Automate* automate_1,  const Automate* automate_2
-){
-	A_FAIRE_RETURN( NULL ); 
-}
\ No newline at end of file
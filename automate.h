@@ -25,6 +25,13 @@
 
 #include "ensemble.h"
 
+#include <stdatomic.h>
+
+/**
+ * @brief Le nombre de lettres possibles : les lettres sont des octets.
+ */
+#define NB_LETTRES 256
+
 /**
  * @brief Le type d'un automate.
  * 
@@ -33,25 +40,104 @@
  * type int. Les lettres sont codées par le type char, et l'automate n'accepte 
  * pas d'epsilon transition.
  * L'automate codé peut avoir plusieurs états initiaux.
+ *
+ * L'automate peut posséder un état puits implicite (voir complementer()) :
+ * toute transition absente de la table des transitions, pour une lettre de
+ * l'alphabet, mène alors à cet état, y compris depuis l'état puits lui-même.
+ * Ces transitions implicites ne sont jamais stockées.
+ *
+ * Les lettres sont des octets : une lettre de type char est toujours lue
+ * comme un octet non signé (de 0 à 255), que ce soit dans l'alphabet, dans
+ * les clés de la table des transitions ou dans l'ordre de parcours des
+ * lettres. Le caractère nul est une lettre comme une autre : les fonctions
+ * de lecture dont le nom contient 'binaire' prennent la longueur du mot en
+ * paramètre et permettent de lire des données qui ne sont pas du texte.
+ *
+ * Les composantes d'un automate peuvent être partagées entre un automate et
+ * ses copies (voir copier_automate()) : une composante partagée est
+ * dupliquée par la première fonction qui la modifie.
  * 
  */
 
+/**
+ * @brief Les composantes d'un automate qui peuvent être partagées entre
+ *        copies.
+ *
+ * Les états comprennent leurs indices denses.
+ */
+enum Composante {
+	COMPOSANTE_ETATS,
+	COMPOSANTE_ALPHABET,
+	COMPOSANTE_TRANSITIONS,
+	COMPOSANTE_INITIAUX,
+	COMPOSANTE_FINAUX,
+	NB_COMPOSANTES
+};
+
 struct Automate {
    Ensemble * vide; //!<
 	Ensemble * etats;
 	Ensemble * alphabet;
 	Table* transitions;
+	//! Les transitions explicites, rangées par (fin, lettre, origine), ou
+	//! NULL si cet index n'est pas tenu (voir indexer_predecesseurs()).
+	Table * entrantes;
+	//! Ensemble d'arrivée -> nombre de couples (origine, lettre) qui le
+	//! partagent (voir partage_des_arrivees()).
+	Table * arrivees;
 	Ensemble * initiaux;
 	Ensemble * finaux;
+	Ensemble * puits; //!< Singleton de l'état puits implicite, ou NULL.
+	Ensemble * co_accessibles; //!< Cache des états co-accessibles, ou NULL.
+	uint64_t lettres[4]; //!< L'alphabet, l'octet l étant codé par le bit l.
+	Table * indices; //!< État -> indice dense (voir indice_de_l_etat()).
+	int * etats_par_indice; //!< Indice dense -> état.
+	int capacite_indices; //!< La taille allouée de etats_par_indice.
+	//! État - base_indices -> indice dense (ou -1), tant que les états
+	//! sont assez serrés ; NULL sinon.
+	int * indices_directs;
+	int base_indices; //!< Le premier état couvert par indices_directs.
+	int taille_indices_directs; //!< Le nombre d'états couverts.
+	int min_etat; //!< Le plus petit état, ou INT_MAX.
+	int max_etat; //!< Le plus grand état, ou INT_MIN.
+	//! Par composante, le nombre d'automates qui la partagent. Le compte est
+	//! alloué avec la composante et modifié atomiquement : copier un
+	//! automate ne modifie pas l'automate copié.
+	atomic_int * references[NB_COMPOSANTES];
 };
 
 typedef struct Automate Automate;
 
 typedef struct Cle {
 	int origine;
-	int lettre;
+	int lettre; //!< La lettre, comme octet non signé.
 } Cle;
 
+/**
+ * @brief Une transition, pour construire un automate en une fois (voir
+ *        creer_automate_a_partir_de()).
+ */
+typedef struct Transition {
+	int origine;
+	char lettre;
+	int fin;
+} Transition;
+
+/**
+ * @brief Le type d'une vue translatée d'un automate.
+ *
+ * Une vue désigne un automate dont tous les états sont translatés par un
+ * entier, sans recopier l'automate : l'état e de l'automate est vu comme
+ * l'état e + translation.
+ *
+ * La vue ne possède pas l'automate, qui doit rester valide tant que la vue
+ * est utilisée.
+ */
+typedef struct Vue_automate {
+	const Automate * automate;
+	int translation;
+} Vue_automate;
+
 /**
  * @brief Crée un automate vide, sans états, sans lettres et sans transitions.
  *
@@ -59,6 +145,39 @@ typedef struct Cle {
  */
 Automate * creer_automate();
 
+/**
+ * @brief Crée un automate à partir d'ensembles déjà construits et d'une
+ *        liste de transitions.
+ *
+ * Les ensembles sont transférés à l'automate, qui les libérera : ils ne
+ * doivent plus être utilisés ni libérés par l'appelant. Un ensemble NULL
+ * est remplacé par un ensemble vide. Les états initiaux et finaux, et les
+ * extrémités des transitions, sont ajoutés aux états ; les lettres des
+ * transitions sont ajoutées à l'alphabet.
+ *
+ * Le tableau des transitions reste à l'appelant, mais il est trié sur place
+ * (par origine, lettre puis fin) et peut contenir des doublons : chaque
+ * ensemble d'arrivée est construit en une seule fois et inséré une seule
+ * fois dans la table des transitions. Hormis un tableau de travail, aucune
+ * allocation n'est faite pour être aussitôt libérée.
+ *
+ * Les indices des états (voir indice_de_l_etat()) suivent l'ordre
+ * croissant des états.
+ *
+ * @param etats Les états, ou NULL.
+ * @param alphabet L'alphabet (des lettres comme octets non signés), ou NULL.
+ * @param initiaux Les états initiaux, ou NULL.
+ * @param finaux Les états finaux, ou NULL.
+ * @param transitions Un tableau de transitions, ou NULL.
+ * @param nb_transitions Le nombre de transitions du tableau.
+ * @return L'automate créé.
+ */
+Automate * creer_automate_a_partir_de(
+	Ensemble * etats, Ensemble * alphabet,
+	Ensemble * initiaux, Ensemble * finaux,
+	Transition * transitions, int nb_transitions
+);
+
 /**
  * @brief Détruit un automate.
  * 
@@ -97,6 +216,24 @@ void ajouter_transition(
 	Automate * automate, int origine, char lettre, int fin
 );
 
+/**
+ * @brief Ajoute un tableau de transitions à l'automate passé en paramètre.
+ *
+ * Le résultat est le même qu'un appel à ajouter_transition() par
+ * transition, mais le tableau est trié sur place (par origine, lettre puis
+ * fin), ce qui élimine les doublons et permet de construire chaque ensemble
+ * d'arrivée en un seul passage, avec une seule recherche dans la table des
+ * transitions par couple (origine, lettre). Les nouveaux états reçoivent
+ * leurs indices dans l'ordre croissant.
+ *
+ * @param automate Un automate.
+ * @param transitions Un tableau de transitions, trié par la fonction.
+ * @param nb_transitions Le nombre de transitions du tableau.
+ */
+void ajouter_transitions(
+	Automate * automate, Transition * transitions, int nb_transitions
+);
+
 /**
  * @brief Ajoute un état final à un automate passé en paramètre.
  *
@@ -270,20 +407,55 @@ Ensemble * delta_star(
 	const Automate* automate, const Ensemble * etats_courants, const char* mot
 );
 
+/**
+ * @brief Comme delta_star(), pour un mot de longueur donnée pouvant contenir
+ *        le caractère nul.
+ *
+ * @param automate Un automate.
+ * @param etats_courants L'ensemble des état origines.
+ * @param mot Le mot à lire.
+ * @param longueur Le nombre de lettres du mot.
+ * @return L'ensemble des états accessibles.
+ */
+Ensemble * delta_star_binaire(
+	const Automate* automate, const Ensemble * etats_courants,
+	const char* mot, int longueur
+);
+
 /**
  * @brief Renvoie vrai si le mot passé en paramètre est reconu par l'automate 
  *        passé en paramètre, et renvoie 0 sinon.
  *
+ * L'automate n'est pas modifié, même pas ses caches : plusieurs fils
+ * d'exécution peuvent reconnaître des mots avec le même automate.
+ *
  * @param automate Un automate.
  * @param mot Le mot à reconnaître.
  * @return 1 ou 0
  */ 
 int le_mot_est_reconnu( const Automate* automate, const char* mot );
 
+/**
+ * @brief Comme le_mot_est_reconnu(), pour un mot de longueur donnée pouvant
+ *        contenir le caractère nul.
+ *
+ * @param automate Un automate.
+ * @param mot Le mot à reconnaître.
+ * @param longueur Le nombre de lettres du mot.
+ * @return 1 ou 0
+ */
+int le_mot_binaire_est_reconnu(
+	const Automate* automate, const char* mot, int longueur
+);
+
 /**
  * @brief La fonction passe en revue toutes les transitions de l'automate et 
  *        appelle la fonction passée en paramètre.
  *
+ * Si l'automate possède un état puits implicite, les transitions implicites
+ * vers cet état sont aussi passées en revue : toutes les transitions le sont
+ * alors par origine puis par lettre croissantes.
+ *
  * La fonction qui sera executée (et qui a été passée en paramètre), doit 
  * posséder l'en-tête suivante :
  *   void NOM_FONCTION( int origine, char lettre, int fin, void* data );
@@ -324,12 +496,95 @@ Automate * translater_automate(
  */
 Automate * translater_automate_entier( const Automate* automate, int translation );
 
+/**
+ * @brief Renvoie une vue de l'automate dont les états sont translatés par un
+ *        entier.
+ *
+ * La vue est obtenue en temps constant, sans copie de l'automate.
+ *
+ * @param automate L'automate à translater.
+ * @param translation L'entier de translation.
+ * @return La vue.
+ */
+Vue_automate vue_automate( const Automate * automate, int translation );
+
+/**
+ * @brief Renvoie une vue de l'automate dont les états évitent ceux du second
+ *        automate passé en paramètre.
+ *
+ * La translation est celle utilisée par translater_automate().
+ *
+ * @param automate L'automate à translater.
+ * @param automate_a_eviter L'automate à éviter.
+ * @return La vue.
+ */
+Vue_automate vue_translatee(
+	const Automate * automate, const Automate * automate_a_eviter
+);
+
+/**
+ * @brief Crée un automate à partir d'une vue, en recopiant l'automate de la
+ *        vue et en translatant ses états.
+ *
+ * L'état puits implicite de l'automate, s'il existe, reste implicite (et
+ * translaté) : il en va de même pour l'union d'une seule vue non vide.
+ *
+ * @param vue Une vue.
+ * @return L'automate créé.
+ */
+Automate * materialiser_vue( Vue_automate vue );
+
+/**
+ * @brief Équivalent de delta1() pour une vue : l'origine et les états
+ *        renvoyés sont des états translatés.
+ *
+ * La mémoire de l'ensemble renvoyé est laissée à la charge de l'utilisateur.
+ *
+ * @param vue Une vue.
+ * @param origine Un état de la vue.
+ * @param lettre Une lettre.
+ * @return L'ensemble des états accessibles.
+ */
+Ensemble * delta1_vue( Vue_automate vue, int origine, char lettre );
+
+/**
+ * @brief Équivalent de delta() pour une vue : les états courants et les états
+ *        renvoyés sont des états translatés.
+ *
+ * La mémoire de l'ensemble renvoyé est laissée à la charge de l'utilisateur.
+ *
+ * @param vue Une vue.
+ * @param etats_courants L'ensemble des états origines.
+ * @param lettre Une lettre.
+ * @return L'ensemble des états accessibles.
+ */
+Ensemble * delta_vue(
+	Vue_automate vue, const Ensemble * etats_courants, char lettre
+);
+
+/**
+ * @brief Équivalent de pour_toute_transition() pour une vue : les origines et
+ *        les fins passées à 'action' sont des états translatés.
+ *
+ * @param vue Une vue.
+ * @param action La fonction à exécuter.
+ * @param data La donnée supplémentaire à passer en paramètre à la fonction
+ *             'action'.
+ */
+void pour_toute_transition_vue(
+	Vue_automate vue,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+);
+
 /**
  * @brief @todo Renvoie l'état ayant le numéro le plus grand de l'automate passé en 
  *        paramètre.
  *
  * Si l'automate est vide (sans état), alors il renvoie INT_MIN.
  * (voir limits.h pour la valeur de INT_MIN).
+ * Le maximum est tenu à jour par ajouter_etat() : la fonction est en temps
+ * constant.
  *
  * @param automate Un automate.
  */
@@ -341,23 +596,93 @@ int get_max_etat( const Automate* automate );
  *  
  * Si l'automate est vide (sans état), alors il renvoie INT_MAX.
  * (voir limits.h pour la valeure de INT_MAX).
+ * Comme get_max_etat(), la fonction est en temps constant.
  *
  * @parama automate Un automate.
  *
  */
 int get_min_etat( const Automate* automate );
 
+/**
+ * @brief Renvoie l'indice dense d'un état de l'automate.
+ *
+ * L'automate numérote ses états de 0 à n-1, n étant son nombre d'états,
+ * dans l'ordre où ils ont été ajoutés. Ces indices permettent de ranger des
+ * informations sur les états dans des tableaux, sans construire de
+ * numérotation.
+ *
+ * Tant que l'étendue des états (max - min + 1) reste de l'ordre de leur
+ * nombre, l'indice est lu dans un tableau, en temps constant ; sinon, il
+ * est cherché dans une table, en O(log n).
+ *
+ * @param automate Un automate.
+ * @param etat Un état.
+ * @return L'indice de l'état, ou -1 si ce n'est pas un état de l'automate.
+ */
+int indice_de_l_etat( const Automate * automate, int etat );
+
+/**
+ * @brief Renvoie l'état d'indice dense 'indice' (voir indice_de_l_etat()).
+ *
+ * @param automate Un automate.
+ * @param indice Un indice compris entre 0 et le nombre d'états moins 1.
+ * @return L'état d'indice 'indice'.
+ */
+int etat_de_l_indice( const Automate * automate, int indice );
+
 /**
  * @brief Copie un automate.
  *
- * L'automate copié et l'automate à copier sont indépendants du point de vue de 
- * la mémoire.
+ * L'automate copié et l'automate à copier sont indépendants : modifier l'un
+ * ne modifie pas l'autre. La copie se fait en temps constant, les
+ * composantes étant partagées ; chacune n'est dupliquée que lorsque l'un des
+ * automates qui la partagent la modifie pour la première fois.
+ *
+ * Les ensembles et les tables sont persistants : dupliquer la table des
+ * transitions ne copie aucun noeud, et chaque modification ne recopie que
+ * le chemin de la racine au noeud modifié. Une chaîne de versions obtenues
+ * par copies et ajouts successifs coûte donc O(log n) par transition
+ * ajoutée ; seul l'ajout d'un nouvel état recopie encore la table des
+ * indices denses, en O(n).
+ *
+ * Les compteurs de partage sont atomiques et la copie ne modifie pas
+ * l'automate copié : plusieurs fils d'exécution peuvent lire et copier le
+ * même automate en même temps, et chacun peut modifier ses propres copies.
+ * Un automate ne doit pas être modifié pendant qu'un autre fil le lit ou le
+ * copie ; etats_co_accessibles(), qui remplit un cache, compte comme une
+ * modification.
  *
  * @param automate L'automate à copier.
  * @return La copie de l'automate.
  */ 
 Automate* copier_automate( const Automate* automate );
 
+/**
+ * @brief Décrit le partage des ensembles d'arrivée d'un automate.
+ *
+ * Les couples (origine, lettre) de mêmes états d'arrivée partagent un unique
+ * ensemble : la mémoire des ensembles d'arrivée est proportionnelle à
+ * nb_fins_stockees, et non à nb_fins.
+ */
+typedef struct Partage_des_arrivees {
+	int nb_couples; //!< Le nombre de couples (origine, lettre) stockés.
+	int nb_ensembles; //!< Le nombre d'ensembles d'arrivée distincts.
+	int nb_fins; //!< Le nombre de transitions stockées.
+	int nb_fins_stockees; //!< La somme des tailles des ensembles distincts.
+} Partage_des_arrivees;
+
+/**
+ * @brief Renvoie le partage des ensembles d'arrivée de l'automate.
+ *
+ * Les taux de partage sont nb_couples / nb_ensembles et
+ * nb_fins / nb_fins_stockees. Les transitions implicites vers l'état puits
+ * ne sont pas comptées.
+ *
+ * @param automate Un automate.
+ * @return Le partage des ensembles d'arrivée.
+ */
+Partage_des_arrivees partage_des_arrivees( const Automate * automate );
+
 /**
  * @brief Renvoie un automate qui reconnaît un unique mot passé en paramètre.
  *
@@ -414,6 +739,246 @@ Automate *automate_accessible( const Automate * automate );
   */
 Automate * creer_automate_du_melange( const Automate* automate1,  const Automate* automate2 );
 
+/**
+ * @brief Crée l'automate du mélange de deux vues.
+ *
+ * Les états de l'automate du mélange sont numérotés à partir de 0, dans
+ * l'ordre où les couples d'états accessibles sont découverts ; la
+ * translation des vues n'a donc pas d'effet sur le résultat.
+ *
+ * @param vue_1 La première vue.
+ * @param vue_2 La deuxième vue.
+ * @return L'automate du mélange.
+ */
+Automate * creer_melange_des_vues( Vue_automate vue_1, Vue_automate vue_2 );
+
+/**
+ * @brief Crée l'automate produit de deux automates.
+ *
+ * Cet automate reconnaît les mots reconnus à la fois par les deux automates
+ * passés en paramètre. Ses états sont les couples d'états accessibles,
+ * numérotés à partir de 0 dans l'ordre où ils sont découverts : les couples
+ * inaccessibles ne sont jamais construits.
+ *
+ * @param automate_1 Le premier automate.
+ * @param automate_2 Le deuxième automate.
+ * @return L'automate de l'intersection.
+ */
+Automate * creer_intersection_des_automates(
+	const Automate * automate_1, const Automate * automate_2
+);
+
+/**
+ * @brief Renvoie 1 si le mot est reconnu à la fois par les deux automates, et
+ *        0 sinon, sans construire l'automate produit.
+ *
+ * Les deux automates sont lus en parallèle, et la lecture s'arrête dès que
+ * l'un d'eux ne peut plus avancer.
+ *
+ * @param automate_1 Le premier automate.
+ * @param automate_2 Le deuxième automate.
+ * @param mot Le mot à reconnaître.
+ * @return 1 ou 0
+ */
+int le_mot_est_reconnu_par_l_intersection(
+	const Automate * automate_1, const Automate * automate_2, const char * mot
+);
+
+/**
+ * @brief Renvoie 1 si l'automate possède un état puits implicite, et 0 sinon.
+ *
+ * @param automate Un automate.
+ * @return 1 ou 0
+ */
+int a_un_etat_puits( const Automate * automate );
+
+/**
+ * @brief Renvoie l'état puits implicite de l'automate.
+ *
+ * L'automate doit posséder un état puits (voir a_un_etat_puits()).
+ *
+ * @param automate Un automate.
+ * @return L'état puits.
+ */
+int get_etat_puits( const Automate * automate );
+
+/**
+ * @brief Crée l'automate déterministe équivalent à l'automate passé en
+ *        paramètre, par la construction des sous-ensembles.
+ *
+ * Seuls les ensembles d'états accessibles et non vides sont construits : ils
+ * sont numérotés à partir de 0, l'état initial (s'il existe) étant 0.
+ * L'automate obtenu n'est pas complet : une transition absente mène à
+ * l'ensemble vide, qui n'est pas représenté.
+ *
+ * @param automate Un automate.
+ * @return L'automate déterminisé.
+ */
+Automate * determiniser( const Automate * automate );
+
+/**
+ * @brief Crée l'automate du complémentaire du langage d'un automate.
+ *
+ * Cet automate reconnaît les mots sur l'alphabet de l'automate passé en
+ * paramètre qui ne sont pas reconnus par celui-ci. Il est obtenu en
+ * déterminisant l'automate et en échangeant ses états finaux et non finaux.
+ *
+ * La complétion est faite par un état puits implicite et final : les
+ * transitions vers cet état ne sont pas stockées, ce qui évite de multiplier
+ * la taille de la table des transitions par la taille de l'alphabet.
+ *
+ * @param automate Un automate.
+ * @return L'automate du complémentaire.
+ */
+Automate * complementer( const Automate * automate );
+
+/**
+ * @brief Crée un automate reconnaissant les mots reconnus par le premier
+ *        automate et non reconnus par le second.
+ *
+ * Le second automate est complémenté sur l'union des deux alphabets, puis
+ * intersecté avec le premier.
+ *
+ * @param automate_1 Le premier automate.
+ * @param automate_2 Le deuxième automate.
+ * @return L'automate de la différence.
+ */
+Automate * difference(
+	const Automate * automate_1, const Automate * automate_2
+);
+
+/**
+ * @brief Renvoie 1 si les deux automates reconnaissent le même langage, et 0
+ *        sinon.
+ *
+ * Les deux automates sont déterminisés à la volée, et leurs états
+ * déterministes sont fusionnés au fur et à mesure par une structure
+ * union-find (algorithme de Hopcroft et Karp) : un couple d'états déjà
+ * connus comme équivalents n'est jamais exploré deux fois.
+ *
+ * Si les langages diffèrent et que 'contre_exemple' n'est pas NULL, la
+ * fonction y écrit un plus court mot reconnu par un seul des deux automates.
+ * La mémoire de ce mot est laissée à la charge de l'utilisateur, qui devra la
+ * libérer avec xfree(). Sinon, *contre_exemple vaut NULL.
+ *
+ * @param automate_1 Le premier automate.
+ * @param automate_2 Le deuxième automate.
+ * @param contre_exemple L'adresse où écrire le contre-exemple, ou NULL.
+ * @return 1 ou 0
+ */
+int sont_equivalents(
+	const Automate * automate_1, const Automate * automate_2,
+	char ** contre_exemple
+);
+
+/**
+ * @brief Renvoie 1 si le langage du premier automate est inclus dans celui du
+ *        second, et 0 sinon.
+ *
+ * Le premier automate est lu tel quel et le second est déterminisé à la
+ * volée. Un couple (p, S) n'est pas exploré si un couple (p, S') avec S'
+ * inclus dans S l'a déjà été (élagage par antichaîne) : tout contre-exemple
+ * trouvé depuis (p, S) l'aurait aussi été depuis (p, S').
+ *
+ * Si l'inclusion est fausse et que 'contre_exemple' n'est pas NULL, la
+ * fonction y écrit un mot reconnu par le premier automate et pas par le
+ * second. La mémoire de ce mot est laissée à la charge de l'utilisateur, qui
+ * devra la libérer avec xfree(). Sinon, *contre_exemple vaut NULL.
+ *
+ * @param automate_1 Le premier automate.
+ * @param automate_2 Le deuxième automate.
+ * @param contre_exemple L'adresse où écrire le contre-exemple, ou NULL.
+ * @return 1 ou 0
+ */
+int est_inclus(
+	const Automate * automate_1, const Automate * automate_2,
+	char ** contre_exemple
+);
+
+/**
+ * @brief Renvoie 1 si l'automate ne reconnaît aucun mot, et 0 sinon.
+ *
+ * La fonction fait un parcours en largeur depuis les états initiaux, en temps
+ * linéaire en le nombre d'états et de transitions de l'automate.
+ *
+ * @param automate Un automate.
+ * @return 1 ou 0
+ */
+int est_vide_langage( const Automate * automate );
+
+/**
+ * @brief Renvoie un plus court mot reconnu par l'automate, ou NULL si
+ *        l'automate ne reconnaît aucun mot.
+ *
+ * Parmi les mots de longueur minimale, le mot renvoyé est le plus petit dans
+ * l'ordre lexicographique.
+ * La mémoire du mot renvoyé est laissée à la charge de l'utilisateur, qui
+ * devra la libérer avec xfree().
+ *
+ * @param automate Un automate.
+ * @return Le mot, ou NULL.
+ */
+char * plus_court_mot( const Automate * automate );
+
+/**
+ * @brief Calcule, pour chaque état, la longueur d'un plus court mot menant de
+ *        cet état à un état final.
+ *
+ * Le tableau renvoyé, de taille le nombre d'états, est indexé par les indices
+ * denses des états (voir indice_de_l_etat()) : la case d'un état
+ * co-accessible (à partir duquel un état final peut être atteint) contient
+ * cette distance, celle des autres états -1. Un état final est à distance 0.
+ *
+ * Lors de la lecture d'un mot, un état dont la distance dépasse le nombre de
+ * lettres restant à lire ne peut plus mener à un état final : il peut être
+ * retiré des états courants.
+ *
+ * La mémoire du tableau renvoyé est laissée à la charge de l'utilisateur,
+ * qui devra la libérer avec xfree().
+ *
+ * @param automate Un automate.
+ * @return Le tableau des distances.
+ */
+int * creer_distances_aux_etats_finaux( const Automate * automate );
+
+/**
+ * @brief Renvoie l'ensemble des états co-accessibles de l'automate,
+ *        c'est-à-dire des états à partir desquels un état final peut être
+ *        atteint.
+ *
+ * L'ensemble est calculé au premier appel puis conservé par l'automate, qui
+ * l'oublie dès qu'il est modifié. La mémoire de l'ensemble renvoyé est gérée
+ * par l'automate : l'ensemble n'est plus valide après une modification de
+ * l'automate.
+ *
+ * Une fois l'ensemble calculé, le_mot_est_reconnu() s'en sert pour abandonner
+ * au plus tôt les états inutiles. Comme elle remplit le cache, cette fonction
+ * modifie l'automate : elle ne doit pas être appelée pendant qu'un autre
+ * fil d'exécution lit le même automate.
+ *
+ * @param automate Un automate.
+ * @return L'ensemble des états co-accessibles.
+ */
+const Ensemble * etats_co_accessibles( Automate * automate );
+
+/**
+ * @brief Partitionne l'alphabet en classes de lettres équivalentes.
+ *
+ * Deux lettres sont équivalentes si, depuis chaque état, elles mènent au
+ * même ensemble d'états : on peut alors remplacer l'une par l'autre dans
+ * n'importe quel mot sans changer son appartenance au langage.
+ *
+ * La fonction remplit le tableau 'classes' de NB_LETTRES cases : la case
+ * d'indice (unsigned char) l contient le numéro de la classe de la lettre l,
+ * ou -1 si l n'est pas une lettre de l'automate. Les classes sont numérotées
+ * à partir de 0 dans l'ordre de leur plus petite lettre.
+ *
+ * @param automate Un automate.
+ * @param classes Le tableau à remplir.
+ * @return Le nombre de classes.
+ */
+int classes_de_lettres( const Automate * automate, int * classes );
+
 /**
  * @brief Affiche sur l'entrée standard (stdout) l'automate passé en paramètre.
  *
@@ -437,6 +1002,159 @@ Automate * creer_union_des_automates(
 	const Automate * automate_1, const Automate * automate_2
 );
 
+/**
+ * @brief Crée l'union d'un tableau d'automates.
+ *
+ * Cet automate reconnaît tous les mots qui sont reconnus par l'un des
+ * automates du tableau.
+ *
+ * Les translations de tous les automates sont calculées avant la
+ * construction : les états du premier automate sont conservés, et ceux de
+ * l'automate i sont translatés juste au-dessus des états de l'automate i-1.
+ * L'automate résultat est ensuite construit en une seule passe, sans copie
+ * intermédiaire des automates translatés.
+ *
+ * Si 'translations' n'est pas NULL, il doit pouvoir contenir 'nb_automates'
+ * entiers : la fonction y écrit la translation appliquée à chaque automate.
+ *
+ * @param automates Un tableau d'automates.
+ * @param nb_automates Le nombre d'automates du tableau.
+ * @param translations Le tableau des translations à remplir, ou NULL.
+ * @return L'automate à créer.
+ */
+Automate * creer_union_de_n_automates(
+	const Automate ** automates, int nb_automates, int * translations
+);
+
+/**
+ * @brief Crée l'union d'un tableau de vues.
+ *
+ * Les états de chaque automate sont placés dans l'automate résultat avec la
+ * translation de sa vue, sans autre translation : si les états de deux vues
+ * se recouvrent, ils sont confondus.
+ *
+ * @param vues Un tableau de vues.
+ * @param nb_vues Le nombre de vues du tableau.
+ * @return L'automate à créer.
+ */
+Automate * creer_union_des_vues( const Vue_automate * vues, int nb_vues );
+
+/**
+ * @brief Le type de l'index des prédécesseurs d'un automate.
+ *
+ * L'index range, pour chaque état, les transitions qui y arrivent, triées
+ * par lettre (comme octet non signé) : les origines des transitions
+ * arrivant dans un état par une lettre sont contiguës. Il est construit en
+ * O(|Q| + |δ|) quand les indices des états sont lus en temps constant (voir
+ * indice_de_l_etat()), en O(|Q| + |δ| log |Q|) sinon, et permet les
+ * parcours à rebours sans construire l'automate miroir.
+ *
+ * L'index décrit l'automate au moment de sa création, transitions vers
+ * l'état puits implicite comprises ; il doit être reconstruit si
+ * l'automate est modifié, et ne doit pas lui survivre.
+ */
+typedef struct Predecesseurs Predecesseurs;
+
+/**
+ * @brief Construit l'index des prédécesseurs d'un automate.
+ *
+ * @param automate Un automate.
+ * @return L'index créé.
+ */
+Predecesseurs * creer_predecesseurs( const Automate * automate );
+
+/**
+ * @brief Détruit un index des prédécesseurs.
+ *
+ * @param predecesseurs L'index à détruire.
+ */
+void liberer_predecesseurs( Predecesseurs * predecesseurs );
+
+/**
+ * @brief Renvoie les origines des transitions qui arrivent dans 'fin' par
+ *        la lettre 'lettre'.
+ *
+ * La recherche est dichotomique parmi les transitions arrivant dans 'fin'.
+ * Les origines sont rangées dans un tableau géré par l'index.
+ *
+ * @param predecesseurs Un index des prédécesseurs.
+ * @param fin Un état.
+ * @param lettre Une lettre.
+ * @param nb Reçoit le nombre d'origines.
+ * @return Le tableau des origines (sans doublon).
+ */
+const int * get_origines(
+	const Predecesseurs * predecesseurs, int fin, char lettre, int * nb
+);
+
+/**
+ * @brief Renvoie l'ensemble des états qui mènent à un état de 'etats' en
+ *        lisant 'lettre'.
+ *
+ * C'est l'opération inverse de delta().
+ *
+ * @param predecesseurs Un index des prédécesseurs.
+ * @param etats Un ensemble d'états.
+ * @param lettre Une lettre.
+ * @return L'ensemble créé.
+ */
+Ensemble * delta_inverse(
+	const Predecesseurs * predecesseurs, const Ensemble * etats, char lettre
+);
+
+/**
+ * @brief Tient à jour, dans l'automate, l'index de ses transitions par état
+ *        d'arrivée.
+ *
+ * L'index est construit en O(|δ| log |δ|) à partir des transitions
+ * explicites, puis tenu à jour par toutes les fonctions qui ajoutent ou
+ * retirent des transitions ; il est partagé entre copies comme les
+ * transitions. Il permet à retirer_etat() de trouver les transitions qui
+ * arrivent dans l'état sans parcourir toutes les transitions. Rien n'est
+ * fait si l'index est déjà tenu.
+ *
+ * @param automate Un automate.
+ */
+void indexer_predecesseurs( Automate * automate );
+
+/**
+ * @brief Retire une transition de l'automate.
+ *
+ * Les états et la lettre de la transition restent dans l'automate. Rien
+ * n'est fait si la transition n'existe pas. Si l'automate a un état puits
+ * implicite, une origine qui n'a plus de transition explicite pour la
+ * lettre mène de nouveau au puits.
+ *
+ * @param automate Un automate.
+ * @param origine L'origine de la transition.
+ * @param lettre La lettre de la transition.
+ * @param fin La fin de la transition.
+ */
+void retirer_transition(
+	Automate * automate, int origine, char lettre, int fin
+);
+
+/**
+ * @brief Retire un état de l'automate, avec toutes les transitions qui en
+ *        partent ou qui y arrivent.
+ *
+ * Les transitions sortantes sont lues dans la table des transitions, à
+ * partir de la clé (etat, 0). Les transitions entrantes sont lues dans
+ * l'index des transitions par état d'arrivée s'il est tenu (voir
+ * indexer_predecesseurs()) : le coût est alors proportionnel au nombre de
+ * transitions touchées, à un facteur log |δ| près. Sinon, toutes les clés
+ * (origine, lettre) de l'automate sont passées en revue.
+ *
+ * Si l'état est l'état puits implicite, les transitions implicites
+ * disparaissent avec lui. Le dernier indice (voir indice_de_l_etat())
+ * prend la place de celui de l'état retiré ; les autres indices ne
+ * changent pas. Rien n'est fait si l'état n'existe pas.
+ *
+ * @param automate Un automate.
+ * @param etat L'état à retirer.
+ */
+void retirer_etat( Automate * automate, int etat );
+
 /**
  * @brief @todo Renvoie l'automate miroir d'un automate.
  *
@@ -0,0 +1,798 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_dense.h"
+#include "automate.h"
+#include "ensemble.h"
+#include "outils.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <assert.h>
+
+typedef struct {
+	Automate_dense * dense;
+	const Automate * deterministe;
+} Donnees_compilation;
+
+void action_compiler_transition( int origine, char lettre, int fin, void* data ){
+	Donnees_compilation * d = (Donnees_compilation*) data;
+	Automate_dense * dense = d->dense;
+	int colonne = dense->colonne[ (unsigned char) lettre ];
+	dense->transitions[
+		indice_de_l_etat( d->deterministe, origine ) * dense->nb_colonnes + colonne
+	] = indice_de_l_etat( d->deterministe, fin );
+}
+
+Automate_dense * compiler_automate( const Automate * automate ){
+	// Les états compilés sont numérotés par leurs indices denses dans
+	// l'automate déterminisé.
+	Automate * deterministe = determiniser( automate );
+	Automate_dense * dense = xmalloc( sizeof(Automate_dense) );
+	int i;
+
+	dense->nb_etats = taille_ensemble( get_etats( deterministe ) );
+	dense->initial = taille_ensemble( get_initiaux( deterministe ) ) == 0 ?
+		-1 :
+		indice_de_l_etat(
+			deterministe,
+			get_element( premier_iterateur_ensemble( get_initiaux( deterministe ) ) )
+		);
+
+	// Une colonne par classe de lettres équivalentes.
+	dense->nb_colonnes = classes_de_lettres( deterministe, dense->colonne );
+	dense->lettres = NULL;
+	dense->debut_colonne = NULL;
+	ranger_lettres_dense( dense );
+
+	int taille = dense->nb_etats * dense->nb_colonnes;
+	dense->transitions = xmalloc( ( taille + 1 ) * sizeof(int) );
+	for( i=0; i<taille; i++ ){
+		dense->transitions[i] = -1;
+	}
+	Donnees_compilation d;
+	d.dense = dense;
+	d.deterministe = deterministe;
+	pour_toute_transition( deterministe, action_compiler_transition, &d );
+
+	dense->finaux = xmalloc( dense->nb_etats + 1 );
+	for( i=0; i<dense->nb_etats; i++ ){
+		dense->finaux[i] = est_un_etat_final_de_l_automate(
+			deterministe, etat_de_l_indice( deterministe, i )
+		);
+	}
+
+	liberer_automate( deterministe );
+	return dense;
+}
+
+void ranger_lettres_dense( Automate_dense * dense ){
+	int i;
+	xfree( dense->lettres );
+	xfree( dense->debut_colonne );
+	dense->nb_lettres = 0;
+	dense->debut_colonne = xmalloc( ( dense->nb_colonnes + 1 ) * sizeof(int) );
+	for( i=0; i<=dense->nb_colonnes; i++ ){
+		dense->debut_colonne[i] = 0;
+	}
+	for( i=0; i<NB_LETTRES; i++ ){
+		if( dense->colonne[i] >= 0 ){
+			dense->debut_colonne[ dense->colonne[i] + 1 ]++;
+			dense->nb_lettres++;
+		}
+	}
+	for( i=0; i<dense->nb_colonnes; i++ ){
+		dense->debut_colonne[i+1] += dense->debut_colonne[i];
+	}
+	dense->lettres = xmalloc( dense->nb_lettres + 1 );
+	int * places = xmalloc( ( dense->nb_colonnes + 1 ) * sizeof(int) );
+	for( i=0; i<dense->nb_colonnes; i++ ){
+		places[i] = dense->debut_colonne[i];
+	}
+	for( i=0; i<NB_LETTRES; i++ ){
+		if( dense->colonne[i] >= 0 ){
+			dense->lettres[ places[ dense->colonne[i] ]++ ] = (char) i;
+		}
+	}
+	xfree( places );
+}
+
+void liberer_automate_dense( Automate_dense * dense ){
+	assert( dense );
+	xfree( dense->lettres );
+	xfree( dense->debut_colonne );
+	xfree( dense->transitions );
+	xfree( dense->finaux );
+	xfree( dense );
+}
+
+/*
+ * Renvoie le nombre de lettres de la colonne c.
+ */
+int taille_colonne( const Automate_dense * dense, int c ){
+	return dense->debut_colonne[c+1] - dense->debut_colonne[c];
+}
+
+int transition_dense( const Automate_dense * dense, int etat, char lettre ){
+	int colonne = dense->colonne[ (unsigned char) lettre ];
+	if( colonne < 0 ) return -1;
+	return dense->transitions[ etat * dense->nb_colonnes + colonne ];
+}
+
+int le_mot_est_reconnu_dense( const Automate_dense * dense, const char * mot ){
+	return le_mot_binaire_est_reconnu_dense( dense, mot, strlen( mot ) );
+}
+
+int le_mot_binaire_est_reconnu_dense(
+	const Automate_dense * dense, const char * mot, int longueur
+){
+	int etat = dense->initial;
+	int i;
+	for( i=0; etat >= 0 && i < longueur; i++ ){
+		etat = transition_dense( dense, etat, mot[i] );
+	}
+	return etat >= 0 && dense->finaux[etat];
+}
+
+void renumeroter_automate_dense( Automate_dense * dense, const int * ordre ){
+	int n = dense->nb_etats;
+	int nb_colonnes = dense->nb_colonnes;
+	int i, c;
+	int * nouveau = xmalloc( ( n + 1 ) * sizeof(int) );
+	for( i=0; i<n; i++ ){
+		nouveau[ ordre[i] ] = i;
+	}
+	int * transitions = xmalloc( ( n * nb_colonnes + 1 ) * sizeof(int) );
+	char * finaux = xmalloc( n + 1 );
+	for( i=0; i<n; i++ ){
+		const int * ligne = dense->transitions + ordre[i] * nb_colonnes;
+		for( c=0; c<nb_colonnes; c++ ){
+			transitions[ i * nb_colonnes + c ] =
+				ligne[c] < 0 ? -1 : nouveau[ ligne[c] ];
+		}
+		finaux[i] = dense->finaux[ ordre[i] ];
+	}
+	if( dense->initial >= 0 ){
+		dense->initial = nouveau[ dense->initial ];
+	}
+	xfree( dense->transitions );
+	xfree( dense->finaux );
+	dense->transitions = transitions;
+	dense->finaux = finaux;
+	xfree( nouveau );
+}
+
+int * ordre_en_largeur_dense( const Automate_dense * dense ){
+	int n = dense->nb_etats;
+	int i, nb = 0;
+	int * ordre = xmalloc( ( n + 1 ) * sizeof(int) );
+	char * vu = xmalloc( n + 1 );
+	for( i=0; i<n; i++ ) vu[i] = 0;
+	if( dense->initial >= 0 ){
+		vu[ dense->initial ] = 1;
+		ordre[ nb++ ] = dense->initial;
+	}
+	// Le début de 'ordre' sert de file.
+	int debut = 0, c;
+	while( debut < nb ){
+		const int * ligne =
+			dense->transitions + ordre[ debut++ ] * dense->nb_colonnes;
+		for( c=0; c<dense->nb_colonnes; c++ ){
+			if( ligne[c] >= 0 && ! vu[ ligne[c] ] ){
+				vu[ ligne[c] ] = 1;
+				ordre[ nb++ ] = ligne[c];
+			}
+		}
+	}
+	// Les états inaccessibles gardent leur ordre relatif, à la fin.
+	for( i=0; i<n; i++ ){
+		if( ! vu[i] ) ordre[ nb++ ] = i;
+	}
+	xfree( vu );
+	return ordre;
+}
+
+int * ordre_en_profondeur_dense( const Automate_dense * dense ){
+	int n = dense->nb_etats;
+	int nb_colonnes = dense->nb_colonnes;
+	int i, c, nb = 0;
+	int * ordre = xmalloc( ( n + 1 ) * sizeof(int) );
+	char * vu = xmalloc( n + 1 );
+	for( i=0; i<n; i++ ) vu[i] = 0;
+	// Chaque transition empile au plus un état.
+	int * pile = xmalloc( ( n * nb_colonnes + 1 ) * sizeof(int) );
+	int sommet = 0;
+	if( dense->initial >= 0 ){
+		pile[ sommet++ ] = dense->initial;
+	}
+	while( sommet > 0 ){
+		int etat = pile[ --sommet ];
+		if( vu[ etat ] ) continue;
+		vu[ etat ] = 1;
+		ordre[ nb++ ] = etat;
+		// Empilés à l'envers, les successeurs sont visités par colonne
+		// croissante.
+		const int * ligne = dense->transitions + etat * nb_colonnes;
+		for( c=nb_colonnes-1; c>=0; c-- ){
+			if( ligne[c] >= 0 && ! vu[ ligne[c] ] ){
+				pile[ sommet++ ] = ligne[c];
+			}
+		}
+	}
+	for( i=0; i<n; i++ ){
+		if( ! vu[i] ) ordre[ nb++ ] = i;
+	}
+	xfree( pile );
+	xfree( vu );
+	return ordre;
+}
+
+int * ordre_par_profil_dense(
+	const Automate_dense * dense, const char ** mots, int nb_mots
+){
+	int n = dense->nb_etats;
+	int i, nb = 0;
+	int * ordre = xmalloc( ( n + 1 ) * sizeof(int) );
+	char * vu = xmalloc( n + 1 );
+	for( i=0; i<n; i++ ) vu[i] = 0;
+	for( i=0; i<nb_mots; i++ ){
+		int etat = dense->initial;
+		const char * c;
+		for( c = mots[i]; etat >= 0; c++ ){
+			if( ! vu[ etat ] ){
+				vu[ etat ] = 1;
+				ordre[ nb++ ] = etat;
+			}
+			if( *c == '\0' ) break;
+			etat = transition_dense( dense, etat, *c );
+		}
+	}
+	// Les états qui n'ont pas servi suivent, en profondeur d'abord.
+	int * profondeur = ordre_en_profondeur_dense( dense );
+	for( i=0; i<n; i++ ){
+		if( ! vu[ profondeur[i] ] ) ordre[ nb++ ] = profondeur[i];
+	}
+	xfree( profondeur );
+	xfree( vu );
+	return ordre;
+}
+
+/*/
+ * Le nombre de mots de longueur n reconnus depuis l'état q vérifie
+ *
+ *   N_0(q) = 1 si q est final, 0 sinon,
+ *   N_n(q) = somme, pour toute lettre l, de N_{n-1}( delta(q, l) ).
+ *
+ * Autrement dit, N_n = M^n.F où M est la matrice d'adjacence de l'automate
+ * (M[q][p] est le nombre de lettres menant de q à p) et F le vecteur des
+ * états finaux. Les calculs sont faits sur des entiers non signés de 64 bits,
+ * donc modulo 2^64.
+/*/
+
+/*
+ * Programmation dynamique : 'longueur' produits M.N, chacun en O(|Q|.|A|).
+ */
+uint64_t nombre_de_mots_par_iteration(
+	const Automate_dense * dense, int longueur
+){
+	int n = dense->nb_etats;
+	uint64_t * courant = xmalloc( ( n + 1 ) * sizeof(uint64_t) );
+	uint64_t * suivant = xmalloc( ( n + 1 ) * sizeof(uint64_t) );
+	int q, c, i;
+	for( q=0; q<n; q++ ){
+		courant[q] = dense->finaux[q];
+	}
+	for( i=0; i<longueur; i++ ){
+		for( q=0; q<n; q++ ){
+			const int * ligne = dense->transitions + q * dense->nb_colonnes;
+			uint64_t somme = 0;
+			for( c=0; c<dense->nb_colonnes; c++ ){
+				if( ligne[c] >= 0 ){
+					somme += (uint64_t) taille_colonne( dense, c ) * courant[ ligne[c] ];
+				}
+			}
+			suivant[q] = somme;
+		}
+		uint64_t * tmp = courant;
+		courant = suivant;
+		suivant = tmp;
+	}
+	uint64_t res = courant[ dense->initial ];
+	xfree( courant );
+	xfree( suivant );
+	return res;
+}
+
+/*
+ * Le nombre maximal de cases d'une matrice |Q| x |Q| : au-delà, les deux
+ * matrices de l'exponentiation rapide (8 octets par case) ne sont pas
+ * allouées, et le calcul se fait par programmation dynamique.
+ */
+#define NB_MAX_CASES_MATRICE ( (size_t) 1 << 22 )
+
+/*
+ * res = a.b, pour des matrices carrées n x n rangées ligne par ligne.
+ * 'res' doit être distinct de 'a' et 'b'.
+ */
+void multiplier_matrices(
+	const uint64_t * a, const uint64_t * b, uint64_t * res, size_t n
+){
+	size_t i, j, k;
+	for( i=0; i<n*n; i++ ) res[i] = 0;
+	for( i=0; i<n; i++ ){
+		for( k=0; k<n; k++ ){
+			uint64_t a_ik = a[ i*n + k ];
+			if( a_ik == 0 ) continue;
+			for( j=0; j<n; j++ ){
+				res[ i*n + j ] += a_ik * b[ k*n + j ];
+			}
+		}
+	}
+}
+
+/*
+ * Exponentiation rapide : on calcule M^longueur.F en O(log(longueur))
+ * produits de matrices. Les puissances de M commutant, on applique au
+ * vecteur chaque puissance M^(2^k) correspondant à un bit de 'longueur'.
+ */
+uint64_t nombre_de_mots_par_puissance(
+	const Automate_dense * dense, int longueur
+){
+	// Les tailles et les indices des matrices sont calculés en size_t : n * n
+	// ne tient pas toujours dans un int.
+	size_t n = dense->nb_etats;
+	uint64_t * puissance = xmalloc( ( n * n + 1 ) * sizeof(uint64_t) );
+	uint64_t * produit = xmalloc( ( n * n + 1 ) * sizeof(uint64_t) );
+	uint64_t * vecteur = xmalloc( ( n + 1 ) * sizeof(uint64_t) );
+	uint64_t * tmp_vecteur = xmalloc( ( n + 1 ) * sizeof(uint64_t) );
+	size_t q, p;
+	int c;
+
+	for( q=0; q<n*n; q++ ) puissance[q] = 0;
+	for( q=0; q<n; q++ ){
+		for( c=0; c<dense->nb_colonnes; c++ ){
+			int fin = dense->transitions[ q * dense->nb_colonnes + c ];
+			if( fin >= 0 ) puissance[ q*n + fin ] += taille_colonne( dense, c );
+		}
+		vecteur[q] = dense->finaux[q];
+	}
+
+	while( longueur > 0 ){
+		if( longueur & 1 ){
+			for( q=0; q<n; q++ ){
+				uint64_t somme = 0;
+				for( p=0; p<n; p++ ){
+					somme += puissance[ q*n + p ] * vecteur[p];
+				}
+				tmp_vecteur[q] = somme;
+			}
+			uint64_t * tmp = vecteur;
+			vecteur = tmp_vecteur;
+			tmp_vecteur = tmp;
+		}
+		longueur >>= 1;
+		if( longueur > 0 ){
+			multiplier_matrices( puissance, puissance, produit, n );
+			uint64_t * tmp = puissance;
+			puissance = produit;
+			produit = tmp;
+		}
+	}
+
+	uint64_t res = vecteur[ dense->initial ];
+	xfree( puissance );
+	xfree( produit );
+	xfree( vecteur );
+	xfree( tmp_vecteur );
+	return res;
+}
+
+uint64_t nombre_de_mots_de_longueur_dense(
+	const Automate_dense * dense, int longueur
+){
+	assert( longueur >= 0 );
+	if( dense->initial < 0 ) return 0;
+	// On choisit le calcul le moins coûteux :
+	// |Q|^3.log(longueur) contre longueur.|Q|.|A|, pourvu que les matrices
+	// |Q| x |Q| restent de taille raisonnable.
+	size_t nb_cases = (size_t) dense->nb_etats * dense->nb_etats;
+	double cout_puissance = (double) nb_cases * log2( longueur + 1 );
+	double cout_iteration = (double) longueur * dense->nb_colonnes;
+	if( nb_cases <= NB_MAX_CASES_MATRICE && cout_puissance < cout_iteration ){
+		return nombre_de_mots_par_puissance( dense, longueur );
+	}
+	return nombre_de_mots_par_iteration( dense, longueur );
+}
+
+uint64_t nombre_de_mots_de_longueur( const Automate * automate, int longueur ){
+	Automate_dense * dense = compiler_automate( automate );
+	uint64_t res = nombre_de_mots_de_longueur_dense( dense, longueur );
+	liberer_automate_dense( dense );
+	return res;
+}
+
+/*/
+ * Le générateur conserve, pour chaque longueur l et chaque état q, le poids
+ * poids[ l * nb_etats + q ], proportionnel au nombre de mots de longueur l
+ * reconnus depuis q. Pour écrire la lettre suivante d'un mot depuis q avec
+ * l lettres restantes, on tire la lettre c avec une probabilité
+ * proportionnelle au poids de delta(q, c) à la longueur l-1.
+ *
+ * Les poids d'une même longueur ne sont comparés qu'entre eux : on peut donc
+ * les diviser tous par le plus grand, facteurs[l], ce qui évite les
+ * débordements. La somme des poids à la longueur l-1 des successeurs de q
+ * vaut alors poids[ l * nb_etats + q ] * facteurs[l], sans avoir à la
+ * recalculer à chaque tirage.
+/*/
+struct Generateur {
+	Automate_dense * dense;
+	int longueur_max;
+	double * poids;
+	double * facteurs;
+};
+
+Generateur * creer_generateur( const Automate * automate, int longueur_max ){
+	assert( longueur_max >= 0 );
+	Generateur * generateur = xmalloc( sizeof(Generateur) );
+	Automate_dense * dense = compiler_automate( automate );
+	int n = dense->nb_etats;
+	int l, q, c;
+	generateur->dense = dense;
+	generateur->longueur_max = longueur_max;
+	generateur->poids = xmalloc(
+		( (size_t) ( longueur_max + 1 ) * n + 1 ) * sizeof(double)
+	);
+	generateur->facteurs = xmalloc( ( longueur_max + 1 ) * sizeof(double) );
+	generateur->facteurs[0] = 1;
+
+	double * poids = generateur->poids;
+	for( q=0; q<n; q++ ){
+		poids[q] = dense->finaux[q];
+	}
+	for( l=1; l<=longueur_max; l++ ){
+		const double * precedents = poids + (size_t) ( l - 1 ) * n;
+		double * courants = poids + (size_t) l * n;
+		double max = 0;
+		for( q=0; q<n; q++ ){
+			const int * ligne = dense->transitions + q * dense->nb_colonnes;
+			double somme = 0;
+			for( c=0; c<dense->nb_colonnes; c++ ){
+				if( ligne[c] >= 0 ){
+					somme += taille_colonne( dense, c ) * precedents[ ligne[c] ];
+				}
+			}
+			courants[q] = somme;
+			if( somme > max ) max = somme;
+		}
+		if( max > 0 ){
+			for( q=0; q<n; q++ ) courants[q] /= max;
+		}
+		generateur->facteurs[l] = max > 0 ? max : 1;
+	}
+	return generateur;
+}
+
+void liberer_generateur( Generateur * generateur ){
+	assert( generateur );
+	liberer_automate_dense( generateur->dense );
+	xfree( generateur->poids );
+	xfree( generateur->facteurs );
+	xfree( generateur );
+}
+
+/*
+ * Renvoie un flottant uniforme dans [0, 1[ (générateur xorshift64*).
+ */
+double tirer_uniforme( uint64_t * graine ){
+	uint64_t x = *graine;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	*graine = x;
+	return ( ( x * 2685821657736338717ULL ) >> 11 ) * ( 1.0 / 9007199254740992.0 );
+}
+
+int generer_mot(
+	const Generateur * generateur, int longueur, char * mot, uint64_t * graine
+){
+	assert( longueur >= 0 && longueur <= generateur->longueur_max );
+	const Automate_dense * dense = generateur->dense;
+	int n = dense->nb_etats;
+	int etat = dense->initial;
+	int l, c;
+
+	if( etat < 0 || generateur->poids[ (size_t) longueur * n + etat ] == 0 ){
+		return 0;
+	}
+
+	for( l = longueur; l > 0; l-- ){
+		const double * suivants = generateur->poids + (size_t) ( l - 1 ) * n;
+		const int * ligne = dense->transitions + etat * dense->nb_colonnes;
+		double total =
+			generateur->poids[ (size_t) l * n + etat ] * generateur->facteurs[l];
+
+		// On choisit d'abord la classe de la lettre, puis la lettre dans sa
+		// classe. En cas d'erreur d'arrondi sur le total, on garde la
+		// dernière lettre possible.
+		double tirage = tirer_uniforme( graine ) * total;
+		int choisie = -1;
+		int rang = 0;
+		for( c=0; c<dense->nb_colonnes; c++ ){
+			if( ligne[c] < 0 || suivants[ ligne[c] ] == 0 ) continue;
+			int taille = taille_colonne( dense, c );
+			double poids_classe = taille * suivants[ ligne[c] ];
+			choisie = c;
+			rang = taille - 1;
+			if( tirage < poids_classe ){
+				rang = (int) ( tirage / suivants[ ligne[c] ] );
+				if( rang >= taille ) rang = taille - 1;
+				break;
+			}
+			tirage -= poids_classe;
+		}
+
+		mot[ longueur - l ] = dense->lettres[ dense->debut_colonne[choisie] + rang ];
+		etat = ligne[choisie];
+	}
+	mot[longueur] = '\0';
+	return 1;
+}
+
+/*
+ * Renvoie le tableau des états co-accessibles de l'automate compilé
+ * (co_accessibles[q] vaut 1 si un état final est accessible depuis q), par
+ * un parcours en largeur des transitions inversées.
+ */
+char * creer_co_accessibles_dense( const Automate_dense * dense ){
+	int n = dense->nb_etats;
+	int taille = n * dense->nb_colonnes;
+	int * debut = xmalloc( ( n + 1 ) * sizeof(int) );
+	int * origines = xmalloc( ( taille + 1 ) * sizeof(int) );
+	int * file = xmalloc( ( n + 1 ) * sizeof(int) );
+	char * co_accessibles = xmalloc( n + 1 );
+	int q, i, tete = 0, queue = 0;
+
+	for( q=0; q<=n; q++ ) debut[q] = 0;
+	for( i=0; i<taille; i++ ){
+		if( dense->transitions[i] >= 0 ) debut[ dense->transitions[i] + 1 ]++;
+	}
+	for( q=0; q<n; q++ ) debut[q+1] += debut[q];
+	for( i=0; i<taille; i++ ){
+		int fin = dense->transitions[i];
+		if( fin >= 0 ) origines[ debut[fin]++ ] = i / dense->nb_colonnes;
+	}
+	// Chaque debut[q] pointe maintenant sur le début de la liste de q+1.
+	for( q=n; q>0; q-- ) debut[q] = debut[q-1];
+	debut[0] = 0;
+
+	for( q=0; q<n; q++ ){
+		co_accessibles[q] = dense->finaux[q];
+		if( co_accessibles[q] ) file[queue++] = q;
+	}
+	while( tete < queue ){
+		q = file[tete++];
+		for( i = debut[q]; i < debut[q+1]; i++ ){
+			if( ! co_accessibles[ origines[i] ] ){
+				co_accessibles[ origines[i] ] = 1;
+				file[queue++] = origines[i];
+			}
+		}
+	}
+
+	xfree( debut );
+	xfree( origines );
+	xfree( file );
+	return co_accessibles;
+}
+
+/*/
+ * L'énumérateur parcourt les mots longueur par longueur. Pour une longueur L,
+ * un parcours en profondeur choisit les lettres par ordre croissant : la
+ * k-ième lettre mène de etats[k] à etats[k+1], et n'est retenue que si un
+ * état final est accessible depuis etats[k+1] en exactement L - k - 1
+ * lettres. Ce test est lu dans la couche L - k - 1 de la table 'atteint' :
+ * atteint[r][q] vaut 1 si un état final est accessible depuis q en
+ * exactement r lettres. Chaque préfixe exploré se prolonge donc en un mot de
+ * longueur L, et passer au mot suivant coûte O(L.|A|). Les couches
+ * sont calculées à la demande, chacune à partir de la précédente.
+ *
+ * Un mot reconnu de longueur l >= n (le nombre d'états) passe deux fois par
+ * un même état : en itérant la boucle, on obtient un mot de longueur
+ * comprise entre l + 1 et l + n. Si le langage est infini, il contient de
+ * plus un mot de longueur comprise entre n et 2n - 1. L'énumération s'arrête
+ * donc dès que n longueurs consécutives, toutes au moins égales à n, n'ont
+ * donné aucun mot.
+/*/
+struct Enumerateur {
+	Automate_dense * dense;
+	char * lettres; // toutes les lettres, par ordre croissant
+	char ** atteint;
+	int nb_couches;
+	int capacite_couches;
+	int longueur; // la longueur des mots en cours d'énumération
+	int derniere_longueur; // la dernière longueur qui a donné un mot
+	int en_cours; // vrai si le mot courant est de longueur 'longueur'
+	int fini;
+	int * etats;
+	int * rangs; // le rang dans 'lettres' de chaque lettre du mot courant
+	char * mot;
+	int capacite_mot;
+};
+
+/*
+ * Calcule les couches de la table 'atteint' jusqu'à la couche 'r' incluse.
+ */
+void calculer_couches( Enumerateur * enumerateur, int r ){
+	const Automate_dense * dense = enumerateur->dense;
+	int n = dense->nb_etats;
+	while( enumerateur->nb_couches <= r ){
+		int k = enumerateur->nb_couches;
+		if( k == enumerateur->capacite_couches ){
+			enumerateur->capacite_couches *= 2;
+			enumerateur->atteint = xrealloc(
+				enumerateur->atteint,
+				enumerateur->capacite_couches * sizeof(char*)
+			);
+		}
+		char * couche = xmalloc( n + 1 );
+		int q, c;
+		if( k == 0 ){
+			for( q=0; q<n; q++ ) couche[q] = dense->finaux[q];
+		}else{
+			const char * precedente = enumerateur->atteint[k-1];
+			for( q=0; q<n; q++ ){
+				const int * ligne = dense->transitions + q * dense->nb_colonnes;
+				couche[q] = 0;
+				for( c=0; c<dense->nb_colonnes && ! couche[q]; c++ ){
+					couche[q] = ligne[c] >= 0 && precedente[ ligne[c] ];
+				}
+			}
+		}
+		enumerateur->atteint[k] = couche;
+		enumerateur->nb_couches++;
+	}
+}
+
+Enumerateur * creer_enumerateur( const Automate * automate ){
+	Enumerateur * enumerateur = xmalloc( sizeof(Enumerateur) );
+	enumerateur->dense = compiler_automate( automate );
+	enumerateur->lettres = xmalloc( enumerateur->dense->nb_lettres + 1 );
+	int i, nb_lettres = 0;
+	for( i=0; i<NB_LETTRES; i++ ){
+		if( enumerateur->dense->colonne[i] >= 0 ){
+			enumerateur->lettres[ nb_lettres++ ] = (char) i;
+		}
+	}
+	enumerateur->nb_couches = 0;
+	enumerateur->capacite_couches = 16;
+	enumerateur->atteint = xmalloc( enumerateur->capacite_couches * sizeof(char*) );
+	enumerateur->longueur = -1;
+	enumerateur->derniere_longueur = -1;
+	enumerateur->en_cours = 0;
+	enumerateur->capacite_mot = 16;
+	enumerateur->etats = xmalloc( enumerateur->capacite_mot * sizeof(int) );
+	enumerateur->rangs = xmalloc( enumerateur->capacite_mot * sizeof(int) );
+	enumerateur->mot = xmalloc( enumerateur->capacite_mot );
+
+	// Si l'état initial n'est pas co-accessible, le langage est vide.
+	int initial = enumerateur->dense->initial;
+	char * co_accessibles = creer_co_accessibles_dense( enumerateur->dense );
+	enumerateur->fini = initial < 0 || ! co_accessibles[initial];
+	xfree( co_accessibles );
+	return enumerateur;
+}
+
+void liberer_enumerateur( Enumerateur * enumerateur ){
+	assert( enumerateur );
+	int k;
+	for( k=0; k<enumerateur->nb_couches; k++ ){
+		xfree( enumerateur->atteint[k] );
+	}
+	xfree( enumerateur->atteint );
+	liberer_automate_dense( enumerateur->dense );
+	xfree( enumerateur->lettres );
+	xfree( enumerateur->etats );
+	xfree( enumerateur->rangs );
+	xfree( enumerateur->mot );
+	xfree( enumerateur );
+}
+
+/*
+ * Complète le mot courant à partir de la position k, les lettres d'avant
+ * étant fixées, en essayant d'abord la lettre de rang 'rang'. Revient sur
+ * les lettres précédentes quand plus aucune lettre ne convient. Renvoie 1 si
+ * un mot de longueur 'longueur' a été trouvé, 0 s'il n'y en a plus.
+ */
+int completer_mot( Enumerateur * enumerateur, int k, int rang ){
+	const Automate_dense * dense = enumerateur->dense;
+	int longueur = enumerateur->longueur;
+	while( k < longueur ){
+		const int * ligne = dense->transitions
+			+ enumerateur->etats[k] * dense->nb_colonnes;
+		const char * utiles = enumerateur->atteint[ longueur - k - 1 ];
+		int fin = -1;
+		for( ; rang < dense->nb_lettres; rang++ ){
+			char lettre = enumerateur->lettres[rang];
+			fin = ligne[ dense->colonne[ (unsigned char) lettre ] ];
+			if( fin >= 0 && utiles[fin] ) break;
+		}
+		if( rang < dense->nb_lettres ){
+			enumerateur->rangs[k] = rang;
+			enumerateur->mot[k] = enumerateur->lettres[rang];
+			enumerateur->etats[k+1] = fin;
+			k++;
+			rang = 0;
+		}else{
+			if( k == 0 ) return 0;
+			k--;
+			rang = enumerateur->rangs[k] + 1;
+		}
+	}
+	enumerateur->mot[longueur] = '\0';
+	return 1;
+}
+
+const char * mot_suivant( Enumerateur * enumerateur ){
+	if( enumerateur->fini ){
+		return NULL;
+	}
+	int longueur = enumerateur->longueur;
+	if(
+		enumerateur->en_cours && longueur > 0
+		&& completer_mot(
+			enumerateur, longueur - 1, enumerateur->rangs[ longueur - 1 ] + 1
+		)
+	){
+		return enumerateur->mot;
+	}
+	enumerateur->en_cours = 0;
+
+	int n = enumerateur->dense->nb_etats;
+	int initial = enumerateur->dense->initial;
+	for(;;){
+		longueur = ++enumerateur->longueur;
+		if( longueur >= 2 * n && longueur - enumerateur->derniere_longueur > n ){
+			enumerateur->fini = 1;
+			return NULL;
+		}
+		calculer_couches( enumerateur, longueur );
+		if( ! enumerateur->atteint[longueur][initial] ){
+			continue;
+		}
+		if( longueur + 1 > enumerateur->capacite_mot ){
+			enumerateur->capacite_mot = 2 * ( longueur + 1 );
+			size_t capacite = enumerateur->capacite_mot;
+			enumerateur->etats = xrealloc(
+				enumerateur->etats, capacite * sizeof(int)
+			);
+			enumerateur->rangs = xrealloc(
+				enumerateur->rangs, capacite * sizeof(int)
+			);
+			enumerateur->mot = xrealloc( enumerateur->mot, capacite );
+		}
+		enumerateur->etats[0] = initial;
+		// La couche 'longueur' garantit qu'un mot existe.
+		completer_mot( enumerateur, 0, 0 );
+		enumerateur->en_cours = 1;
+		enumerateur->derniere_longueur = longueur;
+		return enumerateur->mot;
+	}
+}
@@ -0,0 +1,323 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_dense.h */
+
+#ifndef __AUTOMATE_DENSE_H__
+#define __AUTOMATE_DENSE_H__
+
+#include "automate.h"
+
+#include <stdint.h>
+
+/**
+ * @brief Le type d'un automate déterministe compilé en tableaux.
+ *
+ * Les états sont numérotés de 0 à nb_etats-1. Les lettres sont regroupées
+ * en classes de lettres équivalentes (voir classes_de_lettres()), et chaque
+ * classe correspond à une colonne : la table des transitions a donc
+ * nb_etats lignes de nb_colonnes cases, et non une case par octet. La
+ * transition depuis l'état q par la lettre l mène à l'état :
+ *
+ *   transitions[ q * nb_colonnes + colonne[ (unsigned char) l ] ]
+ *
+ * qui vaut -1 si la transition n'existe pas. colonne[ (unsigned char) l ]
+ * vaut -1 si la lettre n'est pas dans l'alphabet.
+ *
+ * Les lettres de la colonne c sont lettres[ debut_colonne[c] ] à
+ * lettres[ debut_colonne[c+1] - 1 ], par ordre croissant d'octet non signé.
+ */
+struct Automate_dense {
+	int nb_etats;         //!< Le nombre d'états.
+	int nb_colonnes;      //!< Le nombre de classes de lettres.
+	int colonne[NB_LETTRES]; //!< La classe de chaque lettre, ou -1.
+	int nb_lettres;       //!< Le nombre de lettres de l'alphabet.
+	char * lettres;       //!< Les lettres, rangées par classe.
+	int * debut_colonne;  //!< Le début des lettres de chaque classe.
+	int * transitions;    //!< La table des transitions, ligne par ligne.
+	char * finaux;        //!< finaux[q] vaut 1 si q est final, 0 sinon.
+	int initial;          //!< L'état initial, ou -1 s'il n'y en a pas.
+};
+
+typedef struct Automate_dense Automate_dense;
+
+/**
+ * @brief Compile un automate en automate déterministe dense.
+ *
+ * L'automate est d'abord déterminisé (voir determiniser()) : l'automate
+ * compilé reconnaît le même langage, et ses états sont ceux de l'automate
+ * déterminisé.
+ * L'automate passé en paramètre n'est pas modifié.
+ *
+ * @param automate Un automate.
+ * @return L'automate compilé.
+ */
+Automate_dense * compiler_automate( const Automate * automate );
+
+/**
+ * @brief Recalcule les champs nb_lettres, lettres et debut_colonne d'un
+ *        automate compilé à partir de son champ colonne.
+ *
+ * Cette fonction sert aux compilateurs qui construisent la table des
+ * colonnes eux-mêmes (voir compiler_automate_intervalles()).
+ *
+ * @param dense Un automate compilé.
+ */
+void ranger_lettres_dense( Automate_dense * dense );
+
+/**
+ * @brief Renumérote les états d'un automate compilé.
+ *
+ * L'ordre des états détermine la place de leurs lignes dans la table des
+ * transitions : en rapprochant les états souvent visités ensemble, on fait
+ * tenir les lignes lues par une recherche dans moins de lignes de cache.
+ * L'automate reconnaît le même langage après la renumérotation.
+ *
+ * @param dense Un automate compilé.
+ * @param ordre Une permutation des états : l'état ordre[i] devient l'état i.
+ */
+void renumeroter_automate_dense( Automate_dense * dense, const int * ordre );
+
+/**
+ * @brief Renvoie l'ordre des états d'un parcours en largeur depuis l'état
+ *        initial.
+ *
+ * Les successeurs d'un état sont parcourus par colonne croissante ; les
+ * états inaccessibles sont rangés à la fin, dans leur ordre actuel.
+ * Le tableau renvoyé (de taille nb_etats) est à libérer avec xfree() ; il
+ * peut être passé à renumeroter_automate_dense().
+ *
+ * @param dense Un automate compilé.
+ * @return L'ordre des états.
+ */
+int * ordre_en_largeur_dense( const Automate_dense * dense );
+
+/**
+ * @brief Renvoie l'ordre des états d'un parcours en profondeur depuis l'état
+ *        initial.
+ *
+ * Les successeurs d'un état sont parcourus par colonne croissante ; les
+ * états inaccessibles sont rangés à la fin, dans leur ordre actuel. Un
+ * chemin sans branchement occupe ainsi des états consécutifs, ce que ne
+ * garantit pas le parcours en largeur.
+ * Le tableau renvoyé (de taille nb_etats) est à libérer avec xfree().
+ *
+ * @param dense Un automate compilé.
+ * @return L'ordre des états.
+ */
+int * ordre_en_profondeur_dense( const Automate_dense * dense );
+
+/**
+ * @brief Renvoie l'ordre des états de premier passage lors de la lecture
+ *        d'un échantillon de mots.
+ *
+ * Chaque mot est lu depuis l'état initial : les chemins suivis par les mots
+ * de l'échantillon occupent des états consécutifs, en tête de la table des
+ * transitions. Les autres états suivent, dans l'ordre de
+ * ordre_en_profondeur_dense().
+ * Le tableau renvoyé (de taille nb_etats) est à libérer avec xfree().
+ *
+ * @param dense Un automate compilé.
+ * @param mots L'échantillon de mots.
+ * @param nb_mots Le nombre de mots de l'échantillon.
+ * @return L'ordre des états.
+ */
+int * ordre_par_profil_dense(
+	const Automate_dense * dense, const char ** mots, int nb_mots
+);
+
+/**
+ * @brief Détruit un automate compilé.
+ *
+ * @param dense L'automate compilé à détruire.
+ */
+void liberer_automate_dense( Automate_dense * dense );
+
+/**
+ * @brief Renvoie l'état atteint depuis un état par une lettre, ou -1 si la
+ *        transition n'existe pas.
+ *
+ * @param dense Un automate compilé.
+ * @param etat Un état de l'automate compilé.
+ * @param lettre Une lettre.
+ * @return L'état atteint, ou -1.
+ */
+int transition_dense( const Automate_dense * dense, int etat, char lettre );
+
+/**
+ * @brief Renvoie 1 si le mot est reconnu par l'automate compilé, et 0 sinon.
+ *
+ * @param dense Un automate compilé.
+ * @param mot Un mot.
+ * @return 1 ou 0
+ */
+int le_mot_est_reconnu_dense( const Automate_dense * dense, const char * mot );
+
+/**
+ * @brief Comme le_mot_est_reconnu_dense(), pour un mot de longueur donnée
+ *        pouvant contenir le caractère nul.
+ *
+ * @param dense Un automate compilé.
+ * @param mot Un mot.
+ * @param longueur Le nombre de lettres du mot.
+ * @return 1 ou 0
+ */
+int le_mot_binaire_est_reconnu_dense(
+	const Automate_dense * dense, const char * mot, int longueur
+);
+
+/**
+ * @brief Renvoie le nombre de mots de longueur 'longueur' reconnus par
+ *        l'automate, modulo 2^64.
+ *
+ * Les mots sont comptés sur l'automate déterminisé, où chaque mot reconnu
+ * correspond à un unique chemin. Pour les petites longueurs, on compte les
+ * chemins par programmation dynamique en O(longueur.|Q|.|A|) ; pour les
+ * grandes longueurs, on élève la matrice d'adjacence à la puissance
+ * 'longueur' par exponentiation rapide, en O(|Q|^3.log(longueur)).
+ *
+ * @param automate Un automate.
+ * @param longueur Une longueur positive ou nulle.
+ * @return Le nombre de mots reconnus, modulo 2^64.
+ */
+uint64_t nombre_de_mots_de_longueur( const Automate * automate, int longueur );
+
+/**
+ * @brief Renvoie le nombre de mots de longueur 'longueur' reconnus par
+ *        l'automate compilé, modulo 2^64.
+ *
+ * Voir nombre_de_mots_de_longueur().
+ *
+ * @param dense Un automate compilé.
+ * @param longueur Une longueur positive ou nulle.
+ * @return Le nombre de mots reconnus, modulo 2^64.
+ */
+uint64_t nombre_de_mots_de_longueur_dense(
+	const Automate_dense * dense, int longueur
+);
+
+/**
+ * @brief Le type d'un générateur aléatoire uniforme de mots d'un langage.
+ *
+ * Un générateur tire, pour une longueur donnée, un mot reconnu par
+ * l'automate, chaque mot reconnu de cette longueur ayant la même probabilité
+ * d'être tiré.
+ */
+typedef struct Generateur Generateur;
+
+/**
+ * @brief Crée un générateur de mots reconnus par l'automate, de longueur au
+ *        plus 'longueur_max'.
+ *
+ * Le générateur précalcule, pour chaque état de l'automate compilé et chaque
+ * longueur l <= longueur_max, le nombre de mots de longueur l reconnus depuis
+ * cet état, en O(longueur_max.|Q|.|A|). Ces nombres sont des flottants
+ * renormalisés à chaque longueur : ils ne débordent pas, et l'écart à la loi
+ * uniforme est de l'ordre de la précision des flottants.
+ *
+ * L'automate passé en paramètre n'est pas modifié et peut être libéré.
+ *
+ * @param automate Un automate.
+ * @param longueur_max La plus grande longueur des mots à tirer.
+ * @return Le générateur créé.
+ */
+Generateur * creer_generateur( const Automate * automate, int longueur_max );
+
+/**
+ * @brief Détruit un générateur.
+ *
+ * @param generateur Le générateur à détruire.
+ */
+void liberer_generateur( Generateur * generateur );
+
+/**
+ * @brief Tire uniformément un mot de longueur 'longueur' reconnu par
+ *        l'automate du générateur.
+ *
+ * Le mot est écrit dans 'mot', qui doit pouvoir contenir longueur+1
+ * caractères. Le tirage se fait lettre par lettre : chaque lettre est
+ * choisie en un parcours de la ligne de l'état courant, sans recalculer de
+ * nombre de mots.
+ *
+ * Le générateur n'est pas modifié : l'état du générateur pseudo-aléatoire est
+ * la variable pointée par 'graine', que l'utilisateur initialise à une valeur
+ * non nulle. Plusieurs fils d'exécution peuvent ainsi tirer des mots avec le
+ * même générateur, chacun avec sa propre graine.
+ *
+ * @param generateur Un générateur.
+ * @param longueur La longueur du mot, au plus la longueur maximale du
+ *                 générateur.
+ * @param mot Le tableau où écrire le mot.
+ * @param graine L'état du générateur pseudo-aléatoire.
+ * @return 1 si un mot a été tiré, 0 si l'automate ne reconnaît aucun mot de
+ *         cette longueur.
+ */
+int generer_mot(
+	const Generateur * generateur, int longueur, char * mot, uint64_t * graine
+);
+
+/**
+ * @brief Le type d'un énumérateur des mots d'un langage.
+ *
+ * Un énumérateur renvoie un à un les mots reconnus par un automate, dans
+ * l'ordre hiérarchique (par longueur croissante, puis par ordre
+ * lexicographique pour une même longueur).
+ */
+typedef struct Enumerateur Enumerateur;
+
+/**
+ * @brief Crée un énumérateur des mots reconnus par l'automate.
+ *
+ * L'automate est compilé (voir compiler_automate()) ; il n'est pas modifié et
+ * peut être libéré.
+ *
+ * Les mots sont produits à la demande, longueur par longueur, par un parcours
+ * en profondeur de l'automate compilé. Une lettre n'est choisie que si elle
+ * mène à un état depuis lequel un état final est accessible avec le nombre
+ * de lettres restant : chaque préfixe exploré se prolonge en un mot reconnu
+ * de la longueur courante. Le mot suivant s'obtient en O(|w|.|A|), où |w|
+ * est sa longueur et |A| la taille de l'alphabet, et la mémoire est en
+ * O(|w|) pour un automate donné, même quand le plus court mot est long.
+ *
+ * @param automate Un automate.
+ * @return L'énumérateur créé.
+ */
+Enumerateur * creer_enumerateur( const Automate * automate );
+
+/**
+ * @brief Détruit un énumérateur.
+ *
+ * @param enumerateur L'énumérateur à détruire.
+ */
+void liberer_enumerateur( Enumerateur * enumerateur );
+
+/**
+ * @brief Renvoie le mot suivant de l'énumération, ou NULL si tous les mots
+ *        reconnus ont été renvoyés.
+ *
+ * La mémoire du mot renvoyé est gérée par l'énumérateur : le mot n'est plus
+ * valide après l'appel suivant.
+ *
+ * @param enumerateur Un énumérateur.
+ * @return Le mot suivant, ou NULL.
+ */
+const char * mot_suivant( Enumerateur * enumerateur );
+
+#endif
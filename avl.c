@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "avl.h"
+#include "outils.h"
 
 /* Creates and returns a new table
    with comparison function |compare| using parameter |param|
@@ -52,10 +53,139 @@ avl_create (avl_comparison_func *compare, void *param,
   tree->avl_alloc = allocator;
   tree->avl_count = 0;
   tree->avl_generation = 0;
+  tree->avl_copy_item = NULL;
+  tree->avl_destroy_item = NULL;
+  tree->avl_item_size = 0;
 
   return tree;
 }
 
+/* Sets the functions applied to the items of |tree| once its nodes are
+   shared with other trees (see |avl_share()|): |copy| duplicates the item
+   of a shared node that has to be modified, and |destroy| destroys the item
+   of a node when the last reference to the node is dropped, by
+   |avl_delete()| or |avl_destroy()|.  Either may be null. */
+void
+avl_set_item_funcs (struct avl_table *tree, avl_copy_func *copy,
+                    avl_item_func *destroy)
+{
+  assert (tree != NULL);
+  tree->avl_copy_item = copy;
+  tree->avl_destroy_item = destroy;
+}
+
+/* Makes |tree|, which must be empty, store copies of its items of |size|
+   bytes inside its nodes, in the same memory block, instead of pointers
+   to them.  |avl_probe()| then copies the item it inserts, and the item
+   copier (see |avl_set_item_funcs()|) is given the item already copied
+   into its new node, to be completed in place and returned.
+   |size| must keep items aligned as pointers are. */
+void
+avl_set_item_size (struct avl_table *tree, size_t size)
+{
+  assert (tree != NULL && tree->avl_root == NULL);
+  tree->avl_item_size = size;
+}
+
+/* Returns the size of a node of |tree|, with its item if it is stored in
+   the node. */
+#define NODE_SIZE(TREE) (sizeof (struct avl_node) + (TREE)->avl_item_size)
+
+/* Sets |item| as the item of |node|, a node of |tree|, copying it into the
+   node if |tree| stores its items in its nodes. */
+static void
+set_node_item (const struct avl_table *tree, struct avl_node *node,
+               void *item)
+{
+  if (tree->avl_item_size != 0)
+    {
+      node->avl_data = node + 1;
+      memcpy (node->avl_data, item, tree->avl_item_size);
+    }
+  else
+    node->avl_data = item;
+}
+
+/* Drops a reference to |node|.  When none is left, frees the node,
+   applying |destroy|, if non-null, to its item, and drops the references
+   it holds to its subtrees. */
+static void
+release_node (struct avl_table *tree, struct avl_node *node,
+              avl_item_func *destroy)
+{
+  while (node != NULL && atomic_fetch_sub (&node->avl_references, 1) == 1)
+    {
+      struct avl_node *right = node->avl_link[1];
+
+      release_node (tree, node->avl_link[0], destroy);
+      if (destroy != NULL && node->avl_data != NULL)
+        destroy (node->avl_data, tree->avl_param);
+      tree->avl_alloc->libavl_free (tree->avl_alloc, node);
+      node = right;
+    }
+}
+
+/* Makes |*link|, a link of a node private to |tree|, point to a node
+   private to |tree| as well, copying it and its item if it is shared, and
+   returns it.  The reference to the shared node is then dropped like any
+   other: if the other trees released it in the meantime, it is freed
+   here. */
+static struct avl_node *
+own_node (struct avl_table *tree, struct avl_node **link)
+{
+  struct avl_node *p = *link;
+  struct avl_node *q;
+
+  if (p == NULL || atomic_load (&p->avl_references) == 1)
+    return p;
+
+  q = tree->avl_alloc->libavl_malloc (tree->avl_alloc, NODE_SIZE (tree));
+  q->avl_link[0] = p->avl_link[0];
+  q->avl_link[1] = p->avl_link[1];
+  q->avl_balance = p->avl_balance;
+  atomic_init (&q->avl_references, 1);
+  set_node_item (tree, q, p->avl_data);
+  if (tree->avl_copy_item != NULL)
+    q->avl_data = tree->avl_copy_item (q->avl_data, tree->avl_param);
+  if (q->avl_link[0] != NULL)
+    atomic_fetch_add (&q->avl_link[0]->avl_references, 1);
+  if (q->avl_link[1] != NULL)
+    atomic_fetch_add (&q->avl_link[1]->avl_references, 1);
+  *link = q;
+  /* Without a copy function, both nodes hold the same item. */
+  release_node (tree, p,
+                tree->avl_copy_item != NULL ? tree->avl_destroy_item : NULL);
+
+  tree->avl_generation++;
+  return q;
+}
+
+/* Returns a new tree with the same items as |org|, in constant time.
+   Both trees share all their nodes: a tree modified afterwards copies
+   only the O(log n) nodes on the paths it changes, the other tree seeing
+   no change.  The new tree uses the item functions of |org|
+   (see |avl_set_item_funcs()|).
+   Reference counts are atomic: trees sharing nodes may be modified,
+   shared and destroyed by different threads.  A single tree must still
+   not be modified while another thread reads or shares it. */
+struct avl_table *
+avl_share (struct avl_table *org)
+{
+  struct avl_table *new;
+
+  assert (org != NULL);
+  new = org->avl_alloc->libavl_malloc (org->avl_alloc, sizeof *new);
+  if (new == NULL)
+    return NULL;
+
+  *new = *org;
+  new->avl_generation = 0;
+  if (new->avl_root != NULL)
+    atomic_fetch_add (&new->avl_root->avl_references, 1);
+
+  return new;
+}
+
 /* Search |tree| for an item matching |item|, and return it if found.
    Otherwise return |NULL|. */
 void *
@@ -79,7 +209,8 @@ avl_find (const struct avl_table *tree, const void *item)
   return NULL;
 }
 
-/* Inserts |item| into |tree| and returns a pointer to |item|'s address.
+/* Inserts |item| into |tree| and returns a pointer to |item|'s address,
+   or to the address of its copy if items are stored in the nodes.
    If a duplicate item is found in the tree,
    returns a pointer to the duplicate without inserting |item|.
    Returns |NULL| in case of memory allocation failure. */
@@ -97,10 +228,12 @@ avl_probe (struct avl_table *tree, void *item)
 
   assert (tree != NULL && item != NULL);
 
+  /* Every node on the search path is made private to |tree|. */
   z = (struct avl_node *) &tree->avl_root;
-  y = tree->avl_root;
+  y = own_node (tree, &tree->avl_root);
   dir = 0;
-  for (q = z, p = y; p != NULL; q = p, p = p->avl_link[dir])
+  for (q = z, p = y; p != NULL;
+       q = p, p = own_node (tree, &p->avl_link[dir]))
     {
       int cmp = tree->avl_compare (item, p->avl_data, tree->avl_param);
       if (cmp == 0)
@@ -112,14 +245,15 @@ avl_probe (struct avl_table *tree, void *item)
     }
 
   n = q->avl_link[dir] =
-    tree->avl_alloc->libavl_malloc (tree->avl_alloc, sizeof *n);
+    tree->avl_alloc->libavl_malloc (tree->avl_alloc, NODE_SIZE (tree));
   if (n == NULL)
     return NULL;
 
   tree->avl_count++;
-  n->avl_data = item;
+  set_node_item (tree, n, item);
   n->avl_link[0] = n->avl_link[1] = NULL;
   n->avl_balance = 0;
+  atomic_init (&n->avl_references, 1);
   if (y == NULL)
     return &n->avl_data;
 
@@ -198,8 +332,9 @@ avl_probe (struct avl_table *tree, void *item)
 void *
 avl_insert (struct avl_table *table, void *item)
 {
+  size_t count = table->avl_count;
   void **p = avl_probe (table, item);
-  return p == NULL || *p == item ? NULL : *p;
+  return p == NULL || table->avl_count != count ? NULL : *p;
 }
 
 /* Inserts |item| into |table|, replacing any duplicate item.
@@ -209,7 +344,10 @@ avl_insert (struct avl_table *table, void *item)
 void *
 avl_replace (struct avl_table *table, void *item)
 {
-  void **p = avl_probe (table, item);
+  void **p;
+
+  assert (table->avl_item_size == 0);
+  p = avl_probe (table, item);
   if (p == NULL || *p == item)
     return NULL;
   else
@@ -221,7 +359,11 @@ avl_replace (struct avl_table *table, void *item)
 }
 
 /* Deletes from |tree| and returns an item matching |item|.
-   Returns a null pointer if no matching item found. */
+   Returns a null pointer if no matching item found.
+   If |tree| has an item destroyer (see |avl_set_item_funcs()|), the item
+   is destroyed unless other trees still use it without a copy, and the
+   returned pointer only tells that an item was found; so does it if the
+   items are stored in the nodes (see |avl_set_item_size()|). */
 void *
 avl_delete (struct avl_table *tree, const void *item)
 {
@@ -232,9 +374,13 @@ avl_delete (struct avl_table *tree, const void *item)
 
   struct avl_node *p;   /* Traverses tree to find node to delete. */
   int cmp;              /* Result of comparison between |item| and |p|. */
+  int shared;           /* Whether other trees use the deleted item. */
 
   assert (tree != NULL && item != NULL);
 
+  /* Every node on the search path is made private to |tree|; the deleted
+     node is too, with its own copy of the item if there is a copy
+     function. */
   k = 0;
   p = (struct avl_node *) &tree->avl_root;
   for (cmp = -1; cmp != 0;
@@ -242,6 +388,8 @@ avl_delete (struct avl_table *tree, const void *item)
     {
       int dir = cmp > 0;
 
+      if (k > 0)
+        p = own_node (tree, &pa[k - 1]->avl_link[da[k - 1]]);
       pa[k] = p;
       da[k++] = dir;
 
@@ -249,13 +397,16 @@ avl_delete (struct avl_table *tree, const void *item)
       if (p == NULL)
         return NULL;
     }
+  shared = tree->avl_copy_item == NULL
+           && atomic_load (&p->avl_references) > 1;
+  p = own_node (tree, &pa[k - 1]->avl_link[da[k - 1]]);
   item = p->avl_data;
 
   if (p->avl_link[1] == NULL)
     pa[k - 1]->avl_link[da[k - 1]] = p->avl_link[0];
   else
     {
-      struct avl_node *r = p->avl_link[1];
+      struct avl_node *r = own_node (tree, &p->avl_link[1]);
       if (r->avl_link[0] == NULL)
         {
           r->avl_link[0] = p->avl_link[0];
@@ -273,7 +424,7 @@ avl_delete (struct avl_table *tree, const void *item)
             {
               da[k] = 0;
               pa[k++] = r;
-              s = r->avl_link[0];
+              s = own_node (tree, &r->avl_link[0]);
               if (s->avl_link[0] == NULL)
                 break;
 
@@ -291,6 +442,9 @@ avl_delete (struct avl_table *tree, const void *item)
         }
     }
 
+  /* The links of |p| now belong to other nodes. */
+  if (!shared && tree->avl_destroy_item != NULL && item != NULL)
+    tree->avl_destroy_item ((void *) item, tree->avl_param);
   tree->avl_alloc->libavl_free (tree->avl_alloc, p);
 
   assert (k > 0);
@@ -305,12 +459,12 @@ avl_delete (struct avl_table *tree, const void *item)
             break;
           else if (y->avl_balance == +2)
             {
-              struct avl_node *x = y->avl_link[1];
+              struct avl_node *x = own_node (tree, &y->avl_link[1]);
               if (x->avl_balance == -1)
                 {
                   struct avl_node *w;
                   assert (x->avl_balance == -1);
-                  w = x->avl_link[0];
+                  w = own_node (tree, &x->avl_link[0]);
                   x->avl_link[0] = w->avl_link[1];
                   w->avl_link[1] = x;
                   y->avl_link[1] = w->avl_link[0];
@@ -347,12 +501,12 @@ avl_delete (struct avl_table *tree, const void *item)
             break;
           else if (y->avl_balance == -2)
             {
-              struct avl_node *x = y->avl_link[0];
+              struct avl_node *x = own_node (tree, &y->avl_link[0]);
               if (x->avl_balance == +1)
                 {
                   struct avl_node *w;
                   assert (x->avl_balance == +1);
-                  w = x->avl_link[1];
+                  w = own_node (tree, &x->avl_link[1]);
                   x->avl_link[1] = w->avl_link[0];
                   w->avl_link[0] = x;
                   y->avl_link[0] = w->avl_link[1];
@@ -405,15 +559,23 @@ trav_refresh (struct avl_traverser *trav)
       struct avl_node *node = trav->avl_node;
       struct avl_node *i;
 
+      /* The node may have been replaced by a copy (see |own_node()|):
+         it is looked up by its item. */
       trav->avl_height = 0;
       for (i = trav->avl_table->avl_root; i != node; )
         {
+          int c;
+
           assert (trav->avl_height < AVL_MAX_HEIGHT);
           assert (i != NULL);
 
+          c = cmp (node->avl_data, i->avl_data, param);
+          if (c == 0)
+            break;
           trav->avl_stack[trav->avl_height++] = i;
-          i = i->avl_link[cmp (node->avl_data, i->avl_data, param) > 0];
+          i = i->avl_link[c > 0];
         }
+      trav->avl_node = i;
     }
 }
 
@@ -519,6 +681,49 @@ avl_t_find (struct avl_traverser *trav, struct avl_table *tree, void *item)
   return NULL;
 }
 
+/* Searches for the smallest item in |tree| not less than |item|.
+   If one is found, initializes |trav| to it and returns it.
+   Otherwise, initializes |trav| to the null item and returns |NULL|. */
+void *
+avl_t_lower_bound (struct avl_traverser *trav, struct avl_table *tree,
+                   void *item)
+{
+  struct avl_node *p, *q;
+  struct avl_node *best = NULL;
+  size_t best_height = 0;
+
+  assert (trav != NULL && tree != NULL && item != NULL);
+  trav->avl_table = tree;
+  trav->avl_height = 0;
+  trav->avl_generation = tree->avl_generation;
+  for (p = tree->avl_root; p != NULL; p = q)
+    {
+      int cmp = tree->avl_compare (item, p->avl_data, tree->avl_param);
+
+      if (cmp < 0)
+        {
+          /* |p| is a candidate; its ancestors are the current stack. */
+          best = p;
+          best_height = trav->avl_height;
+          q = p->avl_link[0];
+        }
+      else if (cmp > 0)
+        q = p->avl_link[1];
+      else /* |cmp == 0| */
+        {
+          trav->avl_node = p;
+          return p->avl_data;
+        }
+
+      assert (trav->avl_height < AVL_MAX_HEIGHT);
+      trav->avl_stack[trav->avl_height++] = p;
+    }
+
+  trav->avl_height = best_height;
+  trav->avl_node = best;
+  return best != NULL ? best->avl_data : NULL;
+}
+
 /* Attempts to insert |item| into |tree|.
    If |item| is inserted successfully, it is returned and |trav| is
    initialized to its location.
@@ -696,11 +901,47 @@ avl_t_replace (struct avl_traverser *trav, void *new)
   void *old;
 
   assert (trav != NULL && trav->avl_node != NULL && new != NULL);
+  assert (trav->avl_table->avl_item_size == 0);
+  avl_t_own (trav);
   old = trav->avl_node->avl_data;
   trav->avl_node->avl_data = new;
   return old;
 }
 
+/* Makes the nodes from the root of |trav|'s tree down to its current node
+   private to the tree, copying those that are shared, and returns the
+   current item, which may then be modified in place as long as its
+   ordering is unchanged.
+   |trav| must not have the null item selected. */
+void *
+avl_t_own (struct avl_traverser *trav)
+{
+  struct avl_table *tree;
+  struct avl_node **link;
+  size_t i;
+
+  assert (trav != NULL && trav->avl_node != NULL);
+
+  tree = trav->avl_table;
+  if (trav->avl_generation != tree->avl_generation)
+    trav_refresh (trav);
+
+  link = &tree->avl_root;
+  for (i = 0; i < trav->avl_height; i++)
+    {
+      struct avl_node *next = i + 1 < trav->avl_height
+                              ? trav->avl_stack[i + 1] : trav->avl_node;
+      struct avl_node *p = own_node (tree, link);
+
+      trav->avl_stack[i] = p;
+      link = &p->avl_link[p->avl_link[1] == next];
+    }
+  trav->avl_node = own_node (tree, link);
+  trav->avl_generation = tree->avl_generation;
+
+  return trav->avl_node->avl_data;
+}
+
 static void
 copy_error_recovery (struct avl_node **stack, int height,
                      struct avl_table *new, avl_item_func *destroy)
@@ -714,7 +955,8 @@ copy_error_recovery (struct avl_node **stack, int height,
 
 /* Copies |org| to a newly created tree, which is returned.
    If |copy != NULL|, each data item in |org| is first passed to |copy|,
-   and the return values are inserted into the tree,
+   and the return values are inserted into the tree
+   (items stored in the nodes are passed once copied into their new node),
    with |NULL| return values taken as indications of failure.
    On failure, destroys the partially created new tree,
    applying |destroy|, if non-null, to each item in the new tree so far,
@@ -738,6 +980,9 @@ avl_copy (const struct avl_table *org, avl_copy_func *copy,
   if (new == NULL)
     return NULL;
   new->avl_count = org->avl_count;
+  new->avl_copy_item = org->avl_copy_item;
+  new->avl_destroy_item = org->avl_destroy_item;
+  new->avl_item_size = org->avl_item_size;
   if (new->avl_count == 0)
     return new;
 
@@ -750,8 +995,7 @@ avl_copy (const struct avl_table *org, avl_copy_func *copy,
           assert (height < 2 * (AVL_MAX_HEIGHT + 1));
 
           y->avl_link[0] =
-            new->avl_alloc->libavl_malloc (new->avl_alloc,
-                                           sizeof *y->avl_link[0]);
+            new->avl_alloc->libavl_malloc (new->avl_alloc, NODE_SIZE (new));
           if (y->avl_link[0] == NULL)
             {
               if (y != (struct avl_node *) &new->avl_root)
@@ -774,11 +1018,11 @@ avl_copy (const struct avl_table *org, avl_copy_func *copy,
       for (;;)
         {
           y->avl_balance = x->avl_balance;
-          if (copy == NULL)
-            y->avl_data = x->avl_data;
-          else
+          atomic_init (&y->avl_references, 1);
+          set_node_item (new, y, x->avl_data);
+          if (copy != NULL)
             {
-              y->avl_data = copy (x->avl_data, org->avl_param);
+              y->avl_data = copy (y->avl_data, org->avl_param);
               if (y->avl_data == NULL)
                 {
                   y->avl_link[1] = NULL;
@@ -791,7 +1035,7 @@ avl_copy (const struct avl_table *org, avl_copy_func *copy,
             {
               y->avl_link[1] =
                 new->avl_alloc->libavl_malloc (new->avl_alloc,
-                                               sizeof *y->avl_link[1]);
+                                               NODE_SIZE (new));
               if (y->avl_link[1] == NULL)
                 {
                   copy_error_recovery (stack, height, new, destroy);
@@ -815,39 +1059,27 @@ avl_copy (const struct avl_table *org, avl_copy_func *copy,
 }
 
 /* Frees storage allocated for |tree|.
-   If |destroy != NULL|, applies it to each data item in inorder. */
+   Nodes still shared with other trees are kept for them.
+   If |destroy != NULL|, applies it to each data item of a freed node,
+   in inorder; otherwise the item destroyer of |tree| is used, if any
+   (see |avl_set_item_funcs()|). */
 void
 avl_destroy (struct avl_table *tree, avl_item_func *destroy)
 {
-  struct avl_node *p, *q;
-
   assert (tree != NULL);
 
-  for (p = tree->avl_root; p != NULL; p = q)
-    if (p->avl_link[0] == NULL)
-      {
-        q = p->avl_link[1];
-        if (destroy != NULL && p->avl_data != NULL)
-          destroy (p->avl_data, tree->avl_param);
-        tree->avl_alloc->libavl_free (tree->avl_alloc, p);
-      }
-    else
-      {
-        q = p->avl_link[0];
-        p->avl_link[0] = q->avl_link[1];
-        q->avl_link[1] = p;
-      }
-
+  release_node (tree, tree->avl_root,
+                destroy != NULL ? destroy : tree->avl_destroy_item);
   tree->avl_alloc->libavl_free (tree->avl_alloc, tree);
 }
 
-/* Allocates |size| bytes of space using |malloc()|.
-   Returns a null pointer if allocation fails. */
+/* Allocates |size| bytes of space using |xmalloc()|, so that the nodes
+   are counted with the other allocations of the library. */
 void *
 avl_malloc (struct libavl_allocator *allocator, size_t size)
 {
   assert (allocator != NULL && size > 0);
-  return malloc (size);
+  return xmalloc (size);
 }
 
 /* Frees |block|. */
@@ -855,10 +1087,10 @@ void
 avl_free (struct libavl_allocator *allocator, void *block)
 {
   assert (allocator != NULL && block != NULL);
-  free (block);
+  xfree (block);
 }
 
-/* Default memory allocator that uses |malloc()| and |free()|. */
+/* Default memory allocator that uses |xmalloc()| and |xfree()|. */
 struct libavl_allocator avl_allocator_default =
   {
     avl_malloc,
@@ -25,6 +25,7 @@
 #define AVL_H 1
 
 #include <stddef.h>
+#include <stdatomic.h>
 
 /* Function types. */
 typedef int avl_comparison_func (const void *avl_a, const void *avl_b,
@@ -61,14 +62,25 @@ struct avl_table
     struct libavl_allocator *avl_alloc; /* Memory allocator. */
     size_t avl_count;                   /* Number of items in tree. */
     unsigned long avl_generation;       /* Generation number. */
+    avl_copy_func *avl_copy_item;       /* Copies the item of a shared node. */
+    avl_item_func *avl_destroy_item;    /* Destroys the item of a freed node. */
+    size_t avl_item_size;               /* Size of items stored in nodes. */
   };
 
-/* An AVL tree node. */
+/* An AVL tree node.
+   Nodes may be shared between trees (see |avl_share()|): a shared node is
+   never modified, it is copied along with the path leading to it
+   (path copying) before any change.  Reference counts are atomic, so that
+   trees sharing nodes may be modified by different threads.
+   In a tree whose items are stored in the nodes (see |avl_set_item_size()|),
+   the item directly follows the node, in the same block, and |avl_data|
+   points to it. */
 struct avl_node
   {
     struct avl_node *avl_link[2];  /* Subtrees. */
     void *avl_data;                /* Pointer to data. */
     signed char avl_balance;       /* Balance factor. */
+    atomic_uint avl_references;    /* Number of links and roots to node. */
   };
 
 /* AVL traverser structure. */
@@ -87,6 +99,10 @@ struct avl_table *avl_create (avl_comparison_func *, void *,
                               struct libavl_allocator *);
 struct avl_table *avl_copy (const struct avl_table *, avl_copy_func *,
                             avl_item_func *, struct libavl_allocator *);
+struct avl_table *avl_share (struct avl_table *);
+void avl_set_item_funcs (struct avl_table *, avl_copy_func *,
+                         avl_item_func *);
+void avl_set_item_size (struct avl_table *, size_t);
 void avl_destroy (struct avl_table *, avl_item_func *);
 void **avl_probe (struct avl_table *, void *);
 void *avl_insert (struct avl_table *, void *);
@@ -103,12 +119,14 @@ void avl_t_init (struct avl_traverser *, struct avl_table *);
 void *avl_t_first (struct avl_traverser *, struct avl_table *);
 void *avl_t_last (struct avl_traverser *, struct avl_table *);
 void *avl_t_find (struct avl_traverser *, struct avl_table *, void *);
+void *avl_t_lower_bound (struct avl_traverser *, struct avl_table *, void *);
 void *avl_t_insert (struct avl_traverser *, struct avl_table *, void *);
 void *avl_t_copy (struct avl_traverser *, const struct avl_traverser *);
 void *avl_t_next (struct avl_traverser *);
 void *avl_t_prev (struct avl_traverser *);
 void *avl_t_cur (struct avl_traverser *);
 void *avl_t_replace (struct avl_traverser *, void *);
+void *avl_t_own (struct avl_traverser *);
 int avl_t_is_null(struct avl_traverser *);
 
 #endif /* avl.h */
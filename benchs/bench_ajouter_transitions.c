@@ -0,0 +1,77 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Compare la construction d'un automate aléatoire à N transitions par des
+ * appels à ajouter_transition(), et par un seul appel à
+ * ajouter_transitions().
+ *
+ * Usage : bench_ajouter_transitions [N]
+ */
+
+#include "automate.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+int main( int argc, char ** argv ){
+	int n = 500000;
+	if( argc > 1 ) n = atoi( argv[1] );
+	if( n < 1 ) n = 1;
+	int nb_etats = n / 8 + 1;
+
+	Transition * transitions = xmalloc( n * sizeof(Transition) );
+	int i;
+	srand( 42 );
+	for( i=0; i<n; i++ ){
+		transitions[i].origine = rand() % nb_etats;
+		transitions[i].lettre = 'a' + rand() % 26;
+		transitions[i].fin = rand() % nb_etats;
+	}
+
+	clock_t debut = clock();
+	Automate * une_a_une = creer_automate();
+	for( i=0; i<n; i++ ){
+		ajouter_transition(
+			une_a_une, transitions[i].origine, transitions[i].lettre,
+			transitions[i].fin
+		);
+	}
+	double temps_une_a_une = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	debut = clock();
+	Automate * en_bloc = creer_automate();
+	ajouter_transitions( en_bloc, transitions, n );
+	double temps_en_bloc = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	printf(
+		"%d transitions (%u états) : une à une %.3fs, en bloc %.3fs\n",
+		n, taille_ensemble( get_etats( en_bloc ) ),
+		temps_une_a_une, temps_en_bloc
+	);
+
+	liberer_automate( une_a_une );
+	liberer_automate( en_bloc );
+	xfree( transitions );
+	return 0;
+}
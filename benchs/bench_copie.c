@@ -0,0 +1,132 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Compare, sur un automate aléatoire à N transitions, K copies suivies
+ * chacune d'une petite modification (un état final de plus), faites par
+ * copie profonde (recopie transition par transition, comme le faisait
+ * copier_automate()) et par copier_automate(), qui partage les composantes.
+ * Une dernière mesure ajoute une transition à chaque copie partagée : la
+ * table des transitions, la plus grosse composante, est alors dupliquée.
+ *
+ * Usage : bench_copie [N] [K]
+ */
+
+#include "automate.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+void action_recopier_transition( int origine, char lettre, int fin, void* data ){
+	ajouter_transition( (Automate*) data, origine, lettre, fin );
+}
+
+Automate * copie_profonde( const Automate * automate ){
+	Automate * res = creer_automate();
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( get_etats( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_etat( res, get_element( it ) );
+	}
+	for(
+		it = premier_iterateur_ensemble( get_initiaux( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_etat_initial( res, get_element( it ) );
+	}
+	for(
+		it = premier_iterateur_ensemble( get_finaux( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_etat_final( res, get_element( it ) );
+	}
+	pour_toute_transition( automate, action_recopier_transition, res );
+	return res;
+}
+
+int main( int argc, char ** argv ){
+	int n = 100000;
+	int k = 10;
+	if( argc > 1 ) n = atoi( argv[1] );
+	if( argc > 2 ) k = atoi( argv[2] );
+	if( n < 1 ) n = 1;
+	if( k < 1 ) k = 1;
+	int nb_etats = n / 8 + 1;
+
+	Transition * transitions = xmalloc( n * sizeof(Transition) );
+	int i;
+	srand( 42 );
+	for( i=0; i<n; i++ ){
+		transitions[i].origine = rand() % nb_etats;
+		transitions[i].lettre = 'a' + rand() % 26;
+		transitions[i].fin = rand() % nb_etats;
+	}
+	Automate * automate = creer_automate_a_partir_de(
+		NULL, NULL, NULL, NULL, transitions, n
+	);
+	ajouter_etat_initial( automate, 0 );
+	xfree( transitions );
+
+	int nb_finaux = 0;
+	clock_t debut = clock();
+	for( i=0; i<k; i++ ){
+		Automate * copie = copie_profonde( automate );
+		ajouter_etat_final( copie, i % nb_etats );
+		nb_finaux += taille_ensemble( get_finaux( copie ) );
+		liberer_automate( copie );
+	}
+	double temps_profonde = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	debut = clock();
+	for( i=0; i<k; i++ ){
+		Automate * copie = copier_automate( automate );
+		ajouter_etat_final( copie, i % nb_etats );
+		nb_finaux -= taille_ensemble( get_finaux( copie ) );
+		liberer_automate( copie );
+	}
+	double temps_partage = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	debut = clock();
+	for( i=0; i<k; i++ ){
+		Automate * copie = copier_automate( automate );
+		ajouter_transition( copie, i % nb_etats, '#', 0 );
+		liberer_automate( copie );
+	}
+	double temps_transitions = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	printf(
+		"%d copies modifiées d'un automate à %d transitions : "
+		"copie profonde %.3fs, copie partagée %.4fs, "
+		"copie partagée avec une transition de plus %.3fs%s\n",
+		k, n, temps_profonde, temps_partage, temps_transitions,
+		nb_finaux == 0 ? "" : " (résultats différents !)"
+	);
+
+	liberer_automate( automate );
+	return 0;
+}
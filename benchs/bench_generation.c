@@ -0,0 +1,90 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure le débit de génération uniforme de mots sur {a, ..., z} contenant
+ * le facteur "abc", après le précalcul des poids.
+ *
+ * Usage : bench_generation [N] [L] (N mots de longueur L, 1000000 et 32 par
+ *         défaut)
+ */
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+int main( int argc, char ** argv ){
+	int nb_mots = 1000000;
+	int longueur = 32;
+	if( argc > 1 ) nb_mots = atoi( argv[1] );
+	if( argc > 2 ) longueur = atoi( argv[2] );
+	if( longueur < 3 ) longueur = 3;
+
+	Automate * automate = creer_automate();
+	char lettre;
+	for( lettre = 'a'; lettre <= 'z'; lettre++ ){
+		ajouter_transition( automate, 0, lettre, 0 );
+		ajouter_transition( automate, 3, lettre, 3 );
+	}
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'c', 3 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 3 );
+
+	clock_t debut = clock();
+	Generateur * generateur = creer_generateur( automate, longueur );
+	double temps_precalcul = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	char * mot = xmalloc( longueur + 1 );
+	uint64_t graine = 42;
+	int i;
+	long somme = 0;
+	debut = clock();
+	for( i=0; i<nb_mots; i++ ){
+		generer_mot( generateur, longueur, mot, &graine );
+		somme += mot[0];
+	}
+	double temps_generation = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	// Vérification sur quelques mots.
+	int reconnus = 0;
+	for( i=0; i<100; i++ ){
+		generer_mot( generateur, longueur, mot, &graine );
+		reconnus += le_mot_est_reconnu( automate, mot );
+	}
+
+	printf( "précalcul pour la longueur %d : %.3fs\n", longueur, temps_precalcul );
+	printf(
+		"%d mots de longueur %d en %.3fs (%.0f mots/s, %d/100 vérifiés, %ld)\n",
+		nb_mots, longueur, temps_generation,
+		temps_generation > 0 ? nb_mots / temps_generation : 0.0,
+		reconnus, somme % 10
+	);
+
+	xfree( mot );
+	liberer_generateur( generateur );
+	liberer_automate( automate );
+	return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Construit le produit de deux automates à N et N+1 états, dont tous les
+ * couples d'états sont accessibles, puis compare la reconnaissance de mots
+ * aléatoires dans le produit construit et par lecture parallèle.
+ *
+ * Usage : bench_intersection [N] (N = 1000 pour un produit 10^3 x 10^3)
+ */
+
+#include "automate.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NB_MOTS 200
+#define LONGUEUR_MOT 200
+
+/*
+ * Compteur modulo n : 'a' avance de 1, 'b' avance de 2 ; l'état 0 est final.
+ */
+Automate * creer_compteur( int n ){
+	Automate * automate = creer_automate();
+	int i;
+	for( i=0; i<n; i++ ){
+		ajouter_transition( automate, i, 'a', ( i + 1 ) % n );
+		ajouter_transition( automate, i, 'b', ( i + 2 ) % n );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	return automate;
+}
+
+int main( int argc, char ** argv ){
+	int n = 300;
+	if( argc > 1 ) n = atoi( argv[1] );
+	if( n < 2 ) n = 2;
+
+	Automate * aut1 = creer_compteur( n );
+	Automate * aut2 = creer_compteur( n + 1 );
+
+	clock_t debut = clock();
+	Automate * produit = creer_intersection_des_automates( aut1, aut2 );
+	double temps_produit = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	char ** mots = xmalloc( NB_MOTS * sizeof(char*) );
+	int i, j;
+	srand( 42 );
+	for( i=0; i<NB_MOTS; i++ ){
+		mots[i] = xmalloc( LONGUEUR_MOT + 1 );
+		for( j=0; j<LONGUEUR_MOT; j++ ){
+			mots[i][j] = 'a' + rand() % 2;
+		}
+		mots[i][LONGUEUR_MOT] = '\0';
+	}
+
+	int reconnus_produit = 0;
+	debut = clock();
+	for( i=0; i<NB_MOTS; i++ ){
+		reconnus_produit += le_mot_est_reconnu( produit, mots[i] );
+	}
+	double temps_lecture_produit = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	int reconnus_parallele = 0;
+	debut = clock();
+	for( i=0; i<NB_MOTS; i++ ){
+		reconnus_parallele +=
+			le_mot_est_reconnu_par_l_intersection( aut1, aut2, mots[i] );
+	}
+	double temps_lecture_parallele = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	printf(
+		"produit %d x %d : %u états construits en %.3fs\n",
+		n, n + 1, taille_ensemble( get_etats( produit ) ), temps_produit
+	);
+	printf(
+		"%d mots de longueur %d : produit %.3fs (%d reconnus), "
+		"lecture parallèle %.3fs (%d reconnus)\n",
+		NB_MOTS, LONGUEUR_MOT,
+		temps_lecture_produit, reconnus_produit,
+		temps_lecture_parallele, reconnus_parallele
+	);
+
+	for( i=0; i<NB_MOTS; i++ ){
+		xfree( mots[i] );
+	}
+	xfree( mots );
+	liberer_automate( produit );
+	liberer_automate( aut1 );
+	liberer_automate( aut2 );
+	return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Affiche le partage des ensembles d'arrivée (voir partage_des_arrivees())
+ * de quelques automates typiques : un automate aléatoire, le déterminisé de
+ * l'automate des mots dont la k-ième lettre avant la fin est un a et son
+ * miroir, dont les ensembles d'arrivée sont gros, le mélange de deux mots et
+ * son déterminisé. Pour chacun sont
+ * donnés le nombre d'allocations vivantes et le temps de construction.
+ *
+ * Usage : bench_partage_des_arrivees [N]
+ */
+
+#include "automate.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+long allocations_vivantes(){
+	return (long) nombre_d_allocations() - (long) nombre_de_liberations();
+}
+
+void afficher_partage(
+	const char * nom, const Automate * automate, long allocations, double temps
+){
+	Partage_des_arrivees partage = partage_des_arrivees( automate );
+	printf(
+		"%-28s %8d couples, %7d ensembles (x%.1f), %8d fins, "
+		"%7d stockées (x%.1f), %9ld allocations, %.3fs\n",
+		nom, partage.nb_couples, partage.nb_ensembles,
+		(double) partage.nb_couples
+			/ ( partage.nb_ensembles ? partage.nb_ensembles : 1 ),
+		partage.nb_fins, partage.nb_fins_stockees,
+		(double) partage.nb_fins
+			/ ( partage.nb_fins_stockees ? partage.nb_fins_stockees : 1 ),
+		allocations, temps
+	);
+}
+
+/*
+ * Un mot de longueur n sur {a, b}.
+ */
+Automate * mot_aleatoire( int n ){
+	char * mot = xmalloc( n + 1 );
+	int i;
+	for( i=0; i<n; i++ ) mot[i] = 'a' + rand() % 2;
+	mot[n] = '\0';
+	Automate * res = mot_to_automate( mot );
+	xfree( mot );
+	return res;
+}
+
+int main( int argc, char ** argv ){
+	int n = 1000;
+	if( argc > 1 ) n = atoi( argv[1] );
+	if( n < 4 ) n = 4;
+	srand( 42 );
+
+	// Un automate aléatoire à n états sur {a, b, c}, deux transitions par
+	// état et par lettre.
+	Transition * transitions = xmalloc( 6 * n * sizeof(Transition) );
+	int i;
+	for( i=0; i<6*n; i++ ){
+		transitions[i].origine = i / 6;
+		transitions[i].lettre = 'a' + ( i / 2 ) % 3;
+		transitions[i].fin = rand() % n;
+	}
+	long vivantes = allocations_vivantes();
+	clock_t debut = clock();
+	Automate * aleatoire = creer_automate_a_partir_de(
+		NULL, NULL, NULL, NULL, transitions, 6 * n
+	);
+	ajouter_etat_initial( aleatoire, 0 );
+	ajouter_etat_final( aleatoire, n - 1 );
+	afficher_partage(
+		"aléatoire", aleatoire, allocations_vivantes() - vivantes,
+		(double) ( clock() - debut ) / CLOCKS_PER_SEC
+	);
+	xfree( transitions );
+
+	liberer_automate( aleatoire );
+
+	// Les mots dont la k-ième lettre avant la fin est un a : le déterminisé
+	// a 2^k états.
+	int k = 1;
+	while( ( 1 << ( k + 1 ) ) <= n ) k++;
+	Automate * k_ieme = creer_automate();
+	ajouter_transition( k_ieme, 0, 'a', 0 );
+	ajouter_transition( k_ieme, 0, 'b', 0 );
+	ajouter_transition( k_ieme, 0, 'a', 1 );
+	for( i=1; i<k; i++ ){
+		ajouter_transition( k_ieme, i, 'a', i + 1 );
+		ajouter_transition( k_ieme, i, 'b', i + 1 );
+	}
+	ajouter_etat_initial( k_ieme, 0 );
+	ajouter_etat_final( k_ieme, k );
+
+	vivantes = allocations_vivantes();
+	debut = clock();
+	Automate * deterministe = determiniser( k_ieme );
+	afficher_partage(
+		"déterminisé (k-ième lettre)", deterministe,
+		allocations_vivantes() - vivantes,
+		(double) ( clock() - debut ) / CLOCKS_PER_SEC
+	);
+
+	vivantes = allocations_vivantes();
+	debut = clock();
+	Automate * mir = miroir( deterministe );
+	afficher_partage(
+		"miroir du déterminisé", mir, allocations_vivantes() - vivantes,
+		(double) ( clock() - debut ) / CLOCKS_PER_SEC
+	);
+	liberer_automate( mir );
+	liberer_automate( deterministe );
+	liberer_automate( k_ieme );
+
+	int longueur = n / 25 + 2;
+	Automate * mot1 = mot_aleatoire( longueur );
+	Automate * mot2 = mot_aleatoire( longueur );
+	vivantes = allocations_vivantes();
+	debut = clock();
+	Automate * melange = creer_automate_du_melange( mot1, mot2 );
+	afficher_partage(
+		"mélange de deux mots", melange, allocations_vivantes() - vivantes,
+		(double) ( clock() - debut ) / CLOCKS_PER_SEC
+	);
+
+	vivantes = allocations_vivantes();
+	debut = clock();
+	deterministe = determiniser( melange );
+	afficher_partage(
+		"déterminisé du mélange", deterministe,
+		allocations_vivantes() - vivantes,
+		(double) ( clock() - debut ) / CLOCKS_PER_SEC
+	);
+	liberer_automate( deterministe );
+	liberer_automate( melange );
+	liberer_automate( mot1 );
+	liberer_automate( mot2 );
+	return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Compare la reconnaissance de textes rejetés dès la première lettre dans un
+ * automate complet (avec un puits non final), par delta_star() qui lit tout
+ * le texte, et par le_mot_est_reconnu() qui élague les états non
+ * co-accessibles et s'arrête dès que plus aucun état n'est utile.
+ *
+ * Usage : bench_rejet [L] (L = longueur des textes, 100000 par défaut)
+ */
+
+#include "automate.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NB_MOTS_DICTIONNAIRE 50
+#define NB_TEXTES 20
+
+int main( int argc, char ** argv ){
+	int longueur = 100000;
+	if( argc > 1 ) longueur = atoi( argv[1] );
+	if( longueur < 1 ) longueur = 1;
+
+	// Un dictionnaire de mots sur {a, ..., y}, complété deux fois pour
+	// obtenir un automate complet dont le puits n'est pas final.
+	const Automate * mots[NB_MOTS_DICTIONNAIRE];
+	char mot[9];
+	int i, j;
+	srand( 42 );
+	for( i=0; i<NB_MOTS_DICTIONNAIRE; i++ ){
+		for( j=0; j<8; j++ ){
+			mot[j] = 'a' + rand() % 25;
+		}
+		mot[8] = '\0';
+		mots[i] = mot_to_automate( mot );
+	}
+	Automate * dictionnaire = creer_union_de_n_automates(
+		mots, NB_MOTS_DICTIONNAIRE, NULL
+	);
+	ajouter_lettre( dictionnaire, 'z' );
+	Automate * complement = complementer( dictionnaire );
+	Automate * automate = complementer( complement );
+
+	// Des textes commençant par 'z' : aucun mot du dictionnaire ne commence
+	// par cette lettre.
+	char ** textes = xmalloc( NB_TEXTES * sizeof(char*) );
+	for( i=0; i<NB_TEXTES; i++ ){
+		textes[i] = xmalloc( longueur + 1 );
+		textes[i][0] = 'z';
+		for( j=1; j<longueur; j++ ){
+			textes[i][j] = 'a' + rand() % 25;
+		}
+		textes[i][longueur] = '\0';
+	}
+
+	int reconnus_delta_star = 0;
+	clock_t debut = clock();
+	for( i=0; i<NB_TEXTES; i++ ){
+		Ensemble * arrivee = delta_star(
+			automate, get_initiaux( automate ), textes[i]
+		);
+		Ensemble * finaux = creer_intersection_ensemble(
+			arrivee, get_finaux( automate )
+		);
+		reconnus_delta_star += taille_ensemble( finaux ) > 0;
+		liberer_ensemble( finaux );
+		liberer_ensemble( arrivee );
+	}
+	double temps_delta_star = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	debut = clock();
+	etats_co_accessibles( automate );
+	double temps_co_accessibles = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	int reconnus = 0;
+	debut = clock();
+	for( i=0; i<NB_TEXTES; i++ ){
+		reconnus += le_mot_est_reconnu( automate, textes[i] );
+	}
+	double temps_reconnu = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	printf(
+		"automate complet de %u états (%u co-accessibles, calculés en %.3fs)\n",
+		taille_ensemble( get_etats( automate ) ),
+		taille_ensemble( etats_co_accessibles( automate ) ),
+		temps_co_accessibles
+	);
+	printf(
+		"%d textes de longueur %d : delta_star %.3fs (%d reconnus), "
+		"le_mot_est_reconnu %.6fs (%d reconnus)\n",
+		NB_TEXTES, longueur,
+		temps_delta_star, reconnus_delta_star,
+		temps_reconnu, reconnus
+	);
+
+	for( i=0; i<NB_TEXTES; i++ ){
+		xfree( textes[i] );
+	}
+	xfree( textes );
+	for( i=0; i<NB_MOTS_DICTIONNAIRE; i++ ){
+		liberer_automate( (Automate*) mots[i] );
+	}
+	liberer_automate( dictionnaire );
+	liberer_automate( complement );
+	liberer_automate( automate );
+	return 0;
+}
@@ -0,0 +1,182 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure l'effet de l'ordre des états d'un automate compilé sur la lecture.
+ *
+ * L'automate est l'arbre des préfixes d'un dictionnaire de mots aléatoires
+ * sur {a, c, g, t} : sa table des transitions dépasse largement les caches,
+ * et ses lignes sont assez courtes pour que plusieurs états partagent une
+ * ligne de cache.
+ * Les recherches lisent des mots du dictionnaire, tirés selon une loi très
+ * inégale (quelques mots reviennent souvent). On compare l'ordre
+ * d'insertion (chaque mot inséré occupe des états consécutifs), un ordre
+ * aléatoire, puis les ordres en largeur, en profondeur et par profil
+ * (appris sur un échantillon de recherches), appliqués à l'ordre aléatoire.
+ *
+ * Usage : bench_renumerotation [N] [R] (N mots de 24 lettres dans le
+ *         dictionnaire, R recherches ; 200000 et 2000000 par défaut)
+ */
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define LONGUEUR 24
+#define NB_LETTRES_DICO 4
+
+const char lettres_dico[NB_LETTRES_DICO] = { 'a', 'c', 'g', 't' };
+
+uint64_t aleatoire( uint64_t * graine ){
+	*graine ^= *graine >> 12;
+	*graine ^= *graine << 25;
+	*graine ^= *graine >> 27;
+	return *graine * 2685821657736338717ULL;
+}
+
+/*
+ * Lit les recherches et renvoie le temps écoulé.
+ */
+double chronometrer(
+	const Automate_dense * dense, const char ** recherches, int nb, int * reconnus
+){
+	int i;
+	*reconnus = 0;
+	clock_t debut = clock();
+	for( i=0; i<nb; i++ ){
+		*reconnus += le_mot_est_reconnu_dense( dense, recherches[i] );
+	}
+	return (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+}
+
+int main( int argc, char ** argv ){
+	int nb_mots = 200000;
+	int nb_recherches = 2000000;
+	if( argc > 1 ) nb_mots = atoi( argv[1] );
+	if( argc > 2 ) nb_recherches = atoi( argv[2] );
+	if( nb_mots < 1 ) nb_mots = 1;
+
+	uint64_t graine = 42;
+	int i, j;
+	char ** dictionnaire = xmalloc( nb_mots * sizeof(char*) );
+	for( i=0; i<nb_mots; i++ ){
+		dictionnaire[i] = xmalloc( LONGUEUR + 1 );
+		for( j=0; j<LONGUEUR; j++ ){
+			dictionnaire[i][j] =
+				lettres_dico[ aleatoire( &graine ) % NB_LETTRES_DICO ];
+		}
+		dictionnaire[i][LONGUEUR] = '\0';
+	}
+
+	// L'arbre des préfixes est construit directement sous forme compilée :
+	// la compilation d'un automate de cette taille serait bien plus longue
+	// que les mesures.
+	Automate_dense * dense = xmalloc( sizeof(Automate_dense) );
+	dense->nb_colonnes = NB_LETTRES_DICO;
+	for( i=0; i<NB_LETTRES; i++ ) dense->colonne[i] = -1;
+	for( i=0; i<NB_LETTRES_DICO; i++ ){
+		dense->colonne[ (unsigned char) lettres_dico[i] ] = i;
+	}
+	dense->lettres = NULL;
+	dense->debut_colonne = NULL;
+	ranger_lettres_dense( dense );
+	int capacite = nb_mots * LONGUEUR + 1;
+	dense->transitions = xmalloc(
+		capacite * NB_LETTRES_DICO * sizeof(int)
+	);
+	dense->finaux = xmalloc( capacite );
+	for( i=0; i<capacite * NB_LETTRES_DICO; i++ ) dense->transitions[i] = -1;
+	for( i=0; i<capacite; i++ ) dense->finaux[i] = 0;
+	dense->initial = 0;
+	dense->nb_etats = 1;
+	for( i=0; i<nb_mots; i++ ){
+		int etat = 0;
+		for( j=0; j<LONGUEUR; j++ ){
+			int * case_transition = dense->transitions
+				+ etat * NB_LETTRES_DICO
+				+ dense->colonne[ (unsigned char) dictionnaire[i][j] ];
+			if( *case_transition < 0 ){
+				*case_transition = dense->nb_etats++;
+			}
+			etat = *case_transition;
+		}
+		dense->finaux[ etat ] = 1;
+	}
+
+	// Loi inégale : le mot d'indice k est tiré avec une probabilité
+	// décroissant comme 1/k environ.
+	const char ** recherches = xmalloc( nb_recherches * sizeof(char*) );
+	for( i=0; i<nb_recherches; i++ ){
+		uint64_t rang = aleatoire( &graine ) % nb_mots + 1;
+		rang = aleatoire( &graine ) % rang;
+		recherches[i] = dictionnaire[ rang ];
+	}
+
+	int reconnus;
+	printf(
+		"%d états, %d colonnes, table de %.1f Mo\n",
+		dense->nb_etats, dense->nb_colonnes,
+		dense->nb_etats * dense->nb_colonnes * sizeof(int) / 1e6
+	);
+	double t = chronometrer( dense, recherches, nb_recherches, &reconnus );
+	printf( "ordre d'insertion    : %.3fs (%d reconnus)\n", t, reconnus );
+
+	int * ordre = xmalloc( dense->nb_etats * sizeof(int) );
+	for( i=0; i<dense->nb_etats; i++ ) ordre[i] = i;
+	for( i=dense->nb_etats-1; i>0; i-- ){
+		j = aleatoire( &graine ) % ( i + 1 );
+		int echange = ordre[i];
+		ordre[i] = ordre[j];
+		ordre[j] = echange;
+	}
+	renumeroter_automate_dense( dense, ordre );
+	xfree( ordre );
+	t = chronometrer( dense, recherches, nb_recherches, &reconnus );
+	printf( "ordre aléatoire      : %.3fs (%d reconnus)\n", t, reconnus );
+
+	ordre = ordre_en_largeur_dense( dense );
+	renumeroter_automate_dense( dense, ordre );
+	xfree( ordre );
+	t = chronometrer( dense, recherches, nb_recherches, &reconnus );
+	printf( "ordre en largeur     : %.3fs (%d reconnus)\n", t, reconnus );
+
+	ordre = ordre_en_profondeur_dense( dense );
+	renumeroter_automate_dense( dense, ordre );
+	xfree( ordre );
+	t = chronometrer( dense, recherches, nb_recherches, &reconnus );
+	printf( "ordre en profondeur  : %.3fs (%d reconnus)\n", t, reconnus );
+
+	// Le profil est appris sur le premier dixième des recherches.
+	ordre = ordre_par_profil_dense( dense, recherches, nb_recherches / 10 );
+	renumeroter_automate_dense( dense, ordre );
+	xfree( ordre );
+	t = chronometrer( dense, recherches, nb_recherches, &reconnus );
+	printf( "ordre par profil     : %.3fs (%d reconnus)\n", t, reconnus );
+
+	xfree( recherches );
+	liberer_automate_dense( dense );
+	for( i=0; i<nb_mots; i++ ) xfree( dictionnaire[i] );
+	xfree( dictionnaire );
+	return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+/*
+ * Mesure la mémoire occupée par entrée d'une table d'entiers à N entrées,
+ * puis le temps moyen d'une recherche (trouver_table()) parmi ces N clés
+ * et dans une table de N/16 clés de type Ensemble, comme la réserve des
+ * ensembles d'arrivée d'un automate.
+ *
+ * La mémoire est lue dans les statistiques de malloc de la glibc, qui
+ * comptent aussi les en-têtes de bloc ; ailleurs, seul le nombre
+ * d'allocations par entrée est affiché.
+ *
+ * Usage : bench_table [N] [R]    (R : nombre de recherches)
+ */
+
+#include "table.h"
+#include "ensemble.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+long octets_utilises(){
+#ifdef __GLIBC__
+	return (long) mallinfo2().uordblks;
+#else
+	return 0;
+#endif
+}
+
+int main( int argc, char ** argv ){
+	int n = 1000000;
+	int r = 2000000;
+	if( argc > 1 ) n = atoi( argv[1] );
+	if( argc > 2 ) r = atoi( argv[2] );
+	if( n < 16 ) n = 16;
+	if( r < 1 ) r = 1;
+	int i;
+
+	int * cles = xmalloc( n * sizeof(int) );
+	srand( 42 );
+	for( i=0; i<n; i++ ) cles[i] = i;
+	for( i=n-1; i>0; i-- ){
+		int j = rand() % ( i+1 );
+		int tmp = cles[i]; cles[i] = cles[j]; cles[j] = tmp;
+	}
+
+	long octets = octets_utilises();
+	unsigned long allocations = nombre_d_allocations();
+	Table * table = creer_table( NULL, NULL, NULL );
+	for( i=0; i<n; i++ ){
+		add_table( table, cles[i], i );
+	}
+	double allocations_par_entree =
+		(double) ( nombre_d_allocations() - allocations ) / n;
+	double octets_par_entree = (double) ( octets_utilises() - octets ) / n;
+
+	long somme = 0;
+	clock_t debut = clock();
+	for( i=0; i<r; i++ ){
+		somme += get_valeur( trouver_table( table, cles[ ( i * 7919L ) % n ] ) );
+	}
+	double temps_entiers = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	int m = n / 16;
+	Ensemble ** ensembles = xmalloc( m * sizeof(Ensemble*) );
+	Table * reserve = creer_table(
+		( int(*)( const intptr_t, const intptr_t ) ) comparer_ensemble,
+		( intptr_t(*)( const intptr_t ) ) copier_ensemble,
+		( void(*)( intptr_t ) ) liberer_ensemble
+	);
+	for( i=0; i<m; i++ ){
+		ensembles[i] = creer_ensemble( NULL, NULL, NULL );
+		ajouter_element( ensembles[i], i );
+		ajouter_element( ensembles[i], i % 97 );
+		ajouter_element( ensembles[i], -1 );
+		add_table( reserve, (intptr_t) ensembles[i], i );
+	}
+	debut = clock();
+	for( i=0; i<r; i++ ){
+		somme -= get_valeur(
+			trouver_table( reserve, (intptr_t) ensembles[ ( i * 7919L ) % m ] )
+		);
+	}
+	double temps_ensembles = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	printf(
+		"table de %d entiers : %.1f octets et %.2f allocations par entrée ; "
+		"recherche : %.0f ns (clés entières), %.0f ns (clés ensembles)%s\n",
+		n, octets_par_entree, allocations_par_entree,
+		temps_entiers * 1e9 / r, temps_ensembles * 1e9 / r,
+		somme == 0 ? " (somme nulle !)" : ""
+	);
+
+	for( i=0; i<m; i++ ){
+		liberer_ensemble( ensembles[i] );
+	}
+	xfree( ensembles );
+	liberer_table( reserve );
+	liberer_table( table );
+	xfree( cles );
+	return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Compare l'union de N petits automates calculée en repliant
+ * creer_union_des_automates() deux à deux, et calculée en une seule passe par
+ * creer_union_de_n_automates().
+ *
+ * Usage : bench_union [N]
+ */
+
+#include "automate.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define LONGUEUR_MOT 4
+
+int main( int argc, char ** argv ){
+	int n = 500;
+	if( argc > 1 ) n = atoi( argv[1] );
+	if( n < 1 ) n = 1;
+
+	const Automate ** automates = xmalloc( n * sizeof(Automate*) );
+	char mot[LONGUEUR_MOT+1];
+	int i, j;
+	srand( 42 );
+	for( i=0; i<n; i++ ){
+		for( j=0; j<LONGUEUR_MOT; j++ ){
+			mot[j] = 'a' + rand() % 26;
+		}
+		mot[LONGUEUR_MOT] = '\0';
+		automates[i] = mot_to_automate( mot );
+	}
+
+	clock_t debut = clock();
+	Automate * repli = copier_automate( automates[0] );
+	for( i=1; i<n; i++ ){
+		Automate * tmp = creer_union_des_automates( automates[i], repli );
+		liberer_automate( repli );
+		repli = tmp;
+	}
+	double temps_repli = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	debut = clock();
+	Automate * union_n = creer_union_de_n_automates( automates, n, NULL );
+	double temps_n = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	printf(
+		"union de %d automates (%u états) : repli deux à deux %.3fs, "
+		"union n-aire %.3fs\n",
+		n, taille_ensemble( get_etats( union_n ) ), temps_repli, temps_n
+	);
+
+	liberer_automate( repli );
+	liberer_automate( union_n );
+	for( i=0; i<n; i++ ){
+		liberer_automate( (Automate*) automates[i] );
+	}
+	xfree( automates );
+	return 0;
+}
@@ -39,6 +39,17 @@ void supprimer_element( int* element ){
 	xfree( element );
 }
 
+/*
+ * L'empreinte d'un élément (mélangeur de splitmix64) ; celle d'un ensemble est
+ * la somme de celles de ses éléments, qui ne dépend pas de l'ordre des ajouts.
+ */
+uint64_t empreinte_element( intptr_t element ){
+	uint64_t x = (uint64_t) element + 0x9e3779b97f4a7c15ULL;
+	x = ( x ^ ( x >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+	x = ( x ^ ( x >> 27 ) ) * 0x94d049bb133111ebULL;
+	return x ^ ( x >> 31 );
+}
+
 void next_iterators( Table_iterateur * it1, Table_iterateur * it2 ){
 	*it1 = iterateur_suivant_table(*it1);
 	*it2 = iterateur_suivant_table(*it2);
@@ -83,18 +94,29 @@ Ensemble * creer_ensemble(
 	result->comparer_element = comparer_element;
 	result->copier_element = copier_element;
 	result->supprimer_element = supprimer_element;
+	result->empreinte = 0;
+	result->references = 1;
 	return result;
 }
 
+Ensemble * retenir_ensemble( Ensemble * ensemble ){
+	atomic_fetch_add( &ensemble->references, 1 );
+	return ensemble;
+}
+
 void liberer_ensemble( Ensemble * ens ){
-	if(ens){
+	if( ens && atomic_fetch_sub( &ens->references, 1 ) == 1 ){
 		liberer_table( ens->table );
 		xfree( ens );
 	}
 }
 
 void ajouter_element( Ensemble * ensemble, const intptr_t element ){
+	int taille = taille_table( ensemble->table );
 	add_table( ensemble->table, element, (intptr_t) NULL );
+	if( taille_table( ensemble->table ) != taille ){
+		ensemble->empreinte += empreinte_element( element );
+	}
 }
 
 
@@ -121,7 +143,11 @@ void transferer_elements(
 }
 
 void retirer_element( Ensemble * ensemble, const intptr_t element ){
+	int taille = taille_table( ensemble->table );
 	delete_table( ensemble->table, element );
+	if( taille_table( ensemble->table ) != taille ){
+		ensemble->empreinte -= empreinte_element( element );
+	}
 }
 
 void action_retirer_elements( const intptr_t element, void* ens ){
@@ -134,6 +160,7 @@ void retirer_elements( Ensemble * ens1, const Ensemble * ens2 ){
 
 void vider_ensemble( Ensemble * ensemble ){
 	vider_table( ensemble->table );
+	ensemble->empreinte = 0;
 }
 
 int est_dans_l_ensemble( const Ensemble * ensemble, intptr_t element ){
@@ -141,14 +168,25 @@ int est_dans_l_ensemble( const Ensemble * ensemble, intptr_t element ){
 	return ! avl_t_is_null( &it ); 
 }
 
-void action_taille_ensemble( const intptr_t element, void* taille ){
-	(*(int*) taille)+=1;
+int est_un_sous_ensemble( const Ensemble * ens1, const Ensemble * ens2 ){
+	if( taille_ensemble( ens1 ) > taille_ensemble( ens2 ) ) return 0;
+	Table_iterateur it;
+	for(
+		it = premier_iterateur_table( ens1->table );
+		! iterateur_est_vide( it );
+		it = iterateur_suivant_table( it )
+	){
+		if( ! est_dans_l_ensemble( ens2, get_cle( it ) ) ) return 0;
+	}
+	return 1;
+}
+
+uint64_t empreinte_ensemble( const Ensemble * ensemble ){
+	return ensemble->empreinte;
 }
 
 unsigned int taille_ensemble( const Ensemble* ensemble ){
-	int taille = 0;
-	pour_tout_element( ensemble, action_taille_ensemble, &taille );
-	return taille;
+	return taille_table( ensemble->table );
 }
 
 typedef struct {
@@ -205,6 +243,9 @@ void swap_ensemble( Ensemble* ens1, Ensemble* ens2 ){
 	void* tmp = ens1->table;
 	ens1->table = ens2->table;
 	ens2->table = tmp;
+	uint64_t empreinte = ens1->empreinte;
+	ens1->empreinte = ens2->empreinte;
+	ens2->empreinte = empreinte;
 }
 void deplacer_ensemble( Ensemble* ens1, Ensemble* ens2 ){
 	swap_ensemble( ens1, ens2 );
@@ -212,11 +253,15 @@ void deplacer_ensemble( Ensemble* ens1, Ensemble* ens2 ){
 }
 
 Ensemble* copier_ensemble( const Ensemble* ensemble ){
-	Ensemble* res = creer_ensemble(
-		ensemble->comparer_element, ensemble->copier_element,
-		ensemble->supprimer_element
-	);
-	ajouter_elements( res, ensemble  );
+	Ensemble* res = (Ensemble*) xmalloc( sizeof(Ensemble) );
+	// Champ par champ : le compte de détenteurs peut changer dans un autre
+	// fil d'exécution.
+	res->table = copier_table( ensemble->table, NULL, NULL );
+	res->comparer_element = ensemble->comparer_element;
+	res->copier_element = ensemble->copier_element;
+	res->supprimer_element = ensemble->supprimer_element;
+	res->empreinte = ensemble->empreinte;
+	atomic_init( &res->references, 1 );
 	return res;
 }
 
@@ -254,6 +299,10 @@ Ensemble_iterateur premier_iterateur_ensemble( const Ensemble* ensemble ){
 	return premier_iterateur_table( ensemble->table );
 }
 
+Ensemble_iterateur dernier_iterateur_ensemble( const Ensemble* ensemble ){
+	return dernier_iterateur_table( ensemble->table );
+}
+
 Ensemble_iterateur iterateur_suivant_ensemble(
 	const Ensemble_iterateur iterateur
 ){
@@ -23,6 +23,7 @@
 #define __ENSEMBLE_H__
 
 #include <stdint.h>
+#include <stdatomic.h>
 
 #include "avl.h"
 #include "table.h"
@@ -35,6 +36,8 @@ struct Ensemble {
 	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 );
 	intptr_t (*copier_element)( const intptr_t elem );
 	void (*supprimer_element)(intptr_t elem );
+	uint64_t empreinte; // Somme des empreintes des éléments.
+	atomic_int references; // Nombre de détenteurs (voir retenir_ensemble()).
 };
 
 typedef struct Ensemble Ensemble;
@@ -123,6 +126,11 @@ void vider_ensemble( Ensemble * ensemble );
  */
 int est_dans_l_ensemble( const Ensemble * ensemble, const intptr_t element );
 
+/*
+ * Renvoie Vrai si tous les éléments du premier ensemble sont dans le second.
+ */
+int est_un_sous_ensemble( const Ensemble * ens1, const Ensemble * ens2 );
+
 /*
  * Renvoie le nombre d'éléments qui se trouvent dans l'ensemble.
  */
@@ -141,7 +149,28 @@ unsigned int taille_ensemble( const Ensemble* ensemble );
 int comparer_ensemble( const Ensemble* ens1, const Ensemble*  ens2 );
 
 /*
- * Renvoie une copie de l'ensemble passé en paramètre
+ * Renvoie l'empreinte de l'ensemble, en temps constant.
+ *
+ * L'empreinte est tenue à jour à chaque ajout ou retrait et ne dépend que
+ * des valeurs des éléments : deux ensembles d'entiers égaux ont la même
+ * empreinte. Pour des ensembles d'éléments comparés par une fonction,
+ * l'empreinte porte sur les pointeurs et non sur le contenu pointé.
+ */
+uint64_t empreinte_ensemble( const Ensemble * ensemble );
+
+/*
+ * Ajoute un détenteur à l'ensemble et le renvoie. L'ensemble n'est libéré
+ * qu'au dernier appel à liberer_ensemble() : un ensemble créé a un seul
+ * détenteur, chaque appel à retenir_ensemble() en ajoute un. Le compte est
+ * atomique : plusieurs fils d'exécution peuvent retenir et libérer le même
+ * ensemble.
+ */
+Ensemble * retenir_ensemble( Ensemble * ensemble );
+
+/*
+ * Renvoie une copie de l'ensemble passé en paramètre, en temps constant :
+ * les deux ensembles partagent leurs éléments jusqu'à ce que l'un d'eux
+ * soit modifié (voir copier_table()).
  */
 Ensemble* copier_ensemble( const Ensemble* ensemble );
 
@@ -210,6 +239,11 @@ Ensemble_iterateur trouver_ensemble(
  */
 Ensemble_iterateur premier_iterateur_ensemble( const Ensemble* ensemble );
 
+/*
+ * Renvoie un itérateur positionné sur le dernier élement de l'ensemble.
+ */
+Ensemble_iterateur dernier_iterateur_ensemble( const Ensemble* ensemble );
+
 /*
  * Renvoie l'iterateur suivant.
  *
@@ -0,0 +1,698 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "intervalles.h"
+#include "automate.h"
+#include "automate_dense.h"
+#include "ensemble.h"
+#include "table.h"
+#include "outils.h"
+
+#include <assert.h>
+
+/*
+ * Les segments sortant d'un état : segment i = symboles debut[i] à fin[i]
+ * -> arrivees[i]. Les segments sont disjoints et triés.
+ */
+typedef struct {
+	int nb;
+	int capacite;
+	uint32_t * debut;
+	uint32_t * fin;
+	Ensemble ** arrivees;
+} Segments;
+
+struct Automate_intervalles {
+	Ensemble * etats;
+	Ensemble * initiaux;
+	Ensemble * finaux;
+	Table * segments; // origine -> Segments
+	Ensemble * vide;
+};
+
+Segments * creer_segments(){
+	Segments * segments = xmalloc( sizeof(Segments) );
+	segments->nb = 0;
+	segments->capacite = 0;
+	segments->debut = NULL;
+	segments->fin = NULL;
+	segments->arrivees = NULL;
+	return segments;
+}
+
+void liberer_segments( Segments * segments ){
+	int i;
+	for( i=0; i<segments->nb; i++ ){
+		liberer_ensemble( segments->arrivees[i] );
+	}
+	xfree( segments->debut );
+	xfree( segments->fin );
+	xfree( segments->arrivees );
+	xfree( segments );
+}
+
+/*
+ * Ajoute un segment après les autres ; 'arrivees' appartient aux segments.
+ */
+void empiler_segment(
+	Segments * segments, uint32_t debut, uint32_t fin, Ensemble * arrivees
+){
+	if( segments->nb == segments->capacite ){
+		segments->capacite = segments->capacite ? 2 * segments->capacite : 4;
+		segments->debut = xrealloc(
+			segments->debut, segments->capacite * sizeof(uint32_t)
+		);
+		segments->fin = xrealloc(
+			segments->fin, segments->capacite * sizeof(uint32_t)
+		);
+		segments->arrivees = xrealloc(
+			segments->arrivees, segments->capacite * sizeof(Ensemble*)
+		);
+	}
+	segments->debut[ segments->nb ] = debut;
+	segments->fin[ segments->nb ] = fin;
+	segments->arrivees[ segments->nb ] = arrivees;
+	segments->nb++;
+}
+
+Ensemble * singleton( int etat ){
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( res, etat );
+	return res;
+}
+
+/*
+ * Ajoute 'etat' aux arrivées des symboles 'a' à 'b'. Les segments qui
+ * chevauchent [a, b] sont découpés à ses bornes, les trous sont comblés.
+ * Les calculs se font sur 64 bits : b+1 peut dépasser 2^32 - 1.
+ */
+void ajouter_intervalle_segments(
+	Segments * segments, int64_t a, int64_t b, int etat
+){
+	int n = segments->nb;
+
+	// Cas courants : ajout après le dernier segment, ou sur le dernier.
+	if( n == 0 || segments->fin[n-1] < a ){
+		empiler_segment( segments, a, b, singleton( etat ) );
+		return;
+	}
+	if( segments->debut[n-1] == a && segments->fin[n-1] == b ){
+		ajouter_element( segments->arrivees[n-1], etat );
+		return;
+	}
+
+	Segments anciens = *segments;
+	segments->nb = 0;
+	segments->capacite = 0;
+	segments->debut = NULL;
+	segments->fin = NULL;
+	segments->arrivees = NULL;
+
+	int i;
+	int64_t position = a; // premier symbole de [a, b] pas encore couvert
+	for( i=0; i<anciens.nb; i++ ){
+		int64_t d = anciens.debut[i];
+		int64_t e = anciens.fin[i];
+		Ensemble * arrivees = anciens.arrivees[i];
+		if( e < a || d > b ){
+			if( d > b && position <= b ){
+				empiler_segment( segments, position, b, singleton( etat ) );
+				position = b+1;
+			}
+			empiler_segment( segments, d, e, arrivees );
+			continue;
+		}
+		if( d < a ){
+			empiler_segment( segments, d, a-1, copier_ensemble( arrivees ) );
+			d = a;
+		}
+		if( position < d ){
+			empiler_segment( segments, position, d-1, singleton( etat ) );
+		}
+		int64_t m = ( e < b ) ? e : b;
+		Ensemble * reste = ( e > b ) ? copier_ensemble( arrivees ) : NULL;
+		ajouter_element( arrivees, etat );
+		empiler_segment( segments, d, m, arrivees );
+		if( reste ){
+			empiler_segment( segments, b+1, e, reste );
+		}
+		position = m+1;
+	}
+	if( position <= b ){
+		empiler_segment( segments, position, b, singleton( etat ) );
+	}
+	xfree( anciens.debut );
+	xfree( anciens.fin );
+	xfree( anciens.arrivees );
+}
+
+/*
+ * Fusionne les segments contigus qui ont les mêmes arrivées.
+ */
+void fusionner_segments( Segments * segments ){
+	int i, k = 0;
+	for( i=0; i<segments->nb; i++ ){
+		if(
+			k > 0
+			&& (int64_t) segments->fin[k-1] + 1 == segments->debut[i]
+			&& comparer_ensemble(
+				segments->arrivees[k-1], segments->arrivees[i]
+			) == 0
+		){
+			segments->fin[k-1] = segments->fin[i];
+			liberer_ensemble( segments->arrivees[i] );
+		}else{
+			segments->debut[k] = segments->debut[i];
+			segments->fin[k] = segments->fin[i];
+			segments->arrivees[k] = segments->arrivees[i];
+			k++;
+		}
+	}
+	segments->nb = k;
+}
+
+const Segments * get_segments(
+	const Automate_intervalles * automate, int origine
+){
+	Table_iterateur it = trouver_table( automate->segments, origine );
+	if( iterateur_est_vide( it ) ){
+		return NULL;
+	}
+	return (const Segments *) get_valeur( it );
+}
+
+Automate_intervalles * creer_automate_intervalles(){
+	Automate_intervalles * automate = xmalloc( sizeof(Automate_intervalles) );
+	automate->etats = creer_ensemble( NULL, NULL, NULL );
+	automate->initiaux = creer_ensemble( NULL, NULL, NULL );
+	automate->finaux = creer_ensemble( NULL, NULL, NULL );
+	automate->segments = creer_table( NULL, NULL, NULL );
+	automate->vide = creer_ensemble( NULL, NULL, NULL );
+	return automate;
+}
+
+void liberer_automate_intervalles( Automate_intervalles * automate ){
+	assert( automate );
+	pour_toute_valeur_table(
+		automate->segments, ( void(*)(intptr_t) ) liberer_segments
+	);
+	liberer_table( automate->segments );
+	liberer_ensemble( automate->etats );
+	liberer_ensemble( automate->initiaux );
+	liberer_ensemble( automate->finaux );
+	liberer_ensemble( automate->vide );
+	xfree( automate );
+}
+
+void ajouter_etat_intervalles( Automate_intervalles * automate, int etat ){
+	ajouter_element( automate->etats, etat );
+}
+
+void ajouter_etat_initial_intervalles(
+	Automate_intervalles * automate, int etat
+){
+	ajouter_etat_intervalles( automate, etat );
+	ajouter_element( automate->initiaux, etat );
+}
+
+void ajouter_etat_final_intervalles( Automate_intervalles * automate, int etat ){
+	ajouter_etat_intervalles( automate, etat );
+	ajouter_element( automate->finaux, etat );
+}
+
+void ajouter_transition_intervalle(
+	Automate_intervalles * automate, int origine,
+	char debut_lettre, char fin_lettre, int fin
+){
+	ajouter_transition_symboles(
+		automate, origine,
+		(unsigned char) debut_lettre, (unsigned char) fin_lettre, fin
+	);
+}
+
+void ajouter_transition_symboles(
+	Automate_intervalles * automate, int origine,
+	uint32_t debut_symbole, uint32_t fin_symbole, int fin
+){
+	ajouter_etat_intervalles( automate, origine );
+	ajouter_etat_intervalles( automate, fin );
+	if( debut_symbole > fin_symbole ){
+		return;
+	}
+	Segments * segments = (Segments *) get_segments( automate, origine );
+	if( ! segments ){
+		segments = creer_segments();
+		add_table( automate->segments, origine, (intptr_t) segments );
+	}
+	ajouter_intervalle_segments( segments, debut_symbole, fin_symbole, fin );
+}
+
+const Ensemble * voisins_intervalles(
+	const Automate_intervalles * automate, int origine, char lettre
+){
+	return voisins_symbole( automate, origine, (unsigned char) lettre );
+}
+
+const Ensemble * voisins_symbole(
+	const Automate_intervalles * automate, int origine, uint32_t symbole
+){
+	const Segments * segments = get_segments( automate, origine );
+	if( ! segments ){
+		return automate->vide;
+	}
+	// Recherche du dernier segment qui commence avant le symbole.
+	uint32_t l = symbole;
+	int bas = 0, haut = segments->nb;
+	while( bas < haut ){
+		int milieu = ( bas + haut ) / 2;
+		if( segments->debut[milieu] <= l ){
+			bas = milieu + 1;
+		}else{
+			haut = milieu;
+		}
+	}
+	if( bas == 0 || segments->fin[bas-1] < l ){
+		return automate->vide;
+	}
+	return segments->arrivees[bas-1];
+}
+
+int nombre_de_segments( const Automate_intervalles * automate, int origine ){
+	const Segments * segments = get_segments( automate, origine );
+	return segments ? segments->nb : 0;
+}
+
+int le_mot_est_reconnu_intervalles(
+	const Automate_intervalles * automate, const char * mot
+){
+	Ensemble * courants = copier_ensemble( automate->initiaux );
+	const char * c;
+	for( c = mot; *c && taille_ensemble( courants ); c++ ){
+		Ensemble * suivants = creer_ensemble( NULL, NULL, NULL );
+		Ensemble_iterateur it;
+		for(
+			it = premier_iterateur_ensemble( courants );
+			! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
+		){
+			ajouter_elements(
+				suivants, voisins_intervalles( automate, get_element( it ), *c )
+			);
+		}
+		liberer_ensemble( courants );
+		courants = suivants;
+	}
+	Ensemble * finaux = creer_intersection_ensemble( courants, automate->finaux );
+	int res = ( *c == '\0' ) && taille_ensemble( finaux ) > 0;
+	liberer_ensemble( finaux );
+	liberer_ensemble( courants );
+	return res;
+}
+
+void action_automate_vers_intervalles(
+	int origine, char lettre, int fin, void* data
+){
+	ajouter_transition_intervalle(
+		(Automate_intervalles*) data, origine, lettre, lettre, fin
+	);
+}
+
+Automate_intervalles * automate_vers_intervalles( const Automate * automate ){
+	Automate_intervalles * res = creer_automate_intervalles();
+	ajouter_elements( res->etats, get_etats( automate ) );
+	ajouter_elements( res->initiaux, get_initiaux( automate ) );
+	ajouter_elements( res->finaux, get_finaux( automate ) );
+	// Les transitions explicites arrivent triées par origine puis par lettre :
+	// chaque ajout se fait en fin de segments.
+	pour_toute_transition( automate, action_automate_vers_intervalles, res );
+	pour_toute_valeur_table(
+		res->segments, ( void(*)(intptr_t) ) fusionner_segments
+	);
+	return res;
+}
+
+Automate * intervalles_vers_automate( const Automate_intervalles * automate ){
+	Automate * res = creer_automate();
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( automate->etats );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_etat( res, get_element( it ) );
+	}
+	for(
+		it = premier_iterateur_ensemble( automate->initiaux );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_etat_initial( res, get_element( it ) );
+	}
+	for(
+		it = premier_iterateur_ensemble( automate->finaux );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_etat_final( res, get_element( it ) );
+	}
+	Table_iterateur it_table;
+	for(
+		it_table = premier_iterateur_table( automate->segments );
+		! iterateur_est_vide( it_table );
+		it_table = iterateur_suivant_table( it_table )
+	){
+		int origine = get_cle( it_table );
+		const Segments * segments = (const Segments *) get_valeur( it_table );
+		int i, l;
+		for( i=0; i<segments->nb; i++ ){
+			assert( segments->fin[i] < NB_LETTRES );
+			for( l=segments->debut[i]; l<=segments->fin[i]; l++ ){
+				for(
+					it = premier_iterateur_ensemble( segments->arrivees[i] );
+					! iterateur_ensemble_est_vide( it );
+					it = iterateur_suivant_ensemble( it )
+				){
+					ajouter_transition( res, origine, (char) l, get_element( it ) );
+				}
+			}
+		}
+	}
+	return res;
+}
+
+Automate_dense * compiler_automate_intervalles(
+	const Automate_intervalles * automate
+){
+	// marque[l] vaut 1 si l commence un segment élémentaire.
+	char marque[NB_LETTRES + 1] = { 0 };
+	marque[0] = 1;
+	Table_iterateur it_table;
+	for(
+		it_table = premier_iterateur_table( automate->segments );
+		! iterateur_est_vide( it_table );
+		it_table = iterateur_suivant_table( it_table )
+	){
+		const Segments * segments = (const Segments *) get_valeur( it_table );
+		int i;
+		for( i=0; i<segments->nb; i++ ){
+			assert( segments->fin[i] < NB_LETTRES );
+			marque[ segments->debut[i] ] = 1;
+			marque[ segments->fin[i] + 1 ] = 1;
+		}
+	}
+
+	// L'automate sur les seules lettres représentantes des segments
+	// élémentaires.
+	Automate * representants = creer_automate();
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( automate->etats );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_etat( representants, get_element( it ) );
+	}
+	for(
+		it = premier_iterateur_ensemble( automate->initiaux );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_etat_initial( representants, get_element( it ) );
+	}
+	for(
+		it = premier_iterateur_ensemble( automate->finaux );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_etat_final( representants, get_element( it ) );
+	}
+	for(
+		it_table = premier_iterateur_table( automate->segments );
+		! iterateur_est_vide( it_table );
+		it_table = iterateur_suivant_table( it_table )
+	){
+		int origine = get_cle( it_table );
+		const Segments * segments = (const Segments *) get_valeur( it_table );
+		int i, l;
+		for( i=0; i<segments->nb; i++ ){
+			assert( segments->fin[i] < NB_LETTRES );
+			for( l=segments->debut[i]; l<=segments->fin[i]; l++ ){
+				if( ! marque[l] ) continue;
+				for(
+					it = premier_iterateur_ensemble( segments->arrivees[i] );
+					! iterateur_ensemble_est_vide( it );
+					it = iterateur_suivant_ensemble( it )
+				){
+					ajouter_transition(
+						representants, origine, (char) l, get_element( it )
+					);
+				}
+			}
+		}
+	}
+
+	Automate_dense * dense = compiler_automate( representants );
+	liberer_automate( representants );
+
+	// Chaque lettre prend la colonne du représentant de son segment.
+	int l, representant = 0;
+	for( l=0; l<NB_LETTRES; l++ ){
+		if( marque[l] ){
+			representant = l;
+		}else{
+			dense->colonne[l] = dense->colonne[representant];
+		}
+	}
+	ranger_lettres_dense( dense );
+	return dense;
+}
+
+/*
+ * Lit un symbole encodé en UTF-8 au début de 'mot' et avance 'mot'. Renvoie
+ * 0 si l'encodage est invalide : octet inattendu, séquence tronquée ou trop
+ * longue, surrogate ou symbole au-delà de MAX_SYMBOLE_UNICODE.
+ */
+int decoder_utf8( const char ** mot, uint32_t * symbole ){
+	const unsigned char * c = (const unsigned char *) *mot;
+	int longueur;
+	uint32_t s, minimum;
+	if( c[0] < 0x80 ){
+		longueur = 1; s = c[0]; minimum = 0;
+	}else if( ( c[0] & 0xE0 ) == 0xC0 ){
+		longueur = 2; s = c[0] & 0x1F; minimum = 0x80;
+	}else if( ( c[0] & 0xF0 ) == 0xE0 ){
+		longueur = 3; s = c[0] & 0x0F; minimum = 0x800;
+	}else if( ( c[0] & 0xF8 ) == 0xF0 ){
+		longueur = 4; s = c[0] & 0x07; minimum = 0x10000;
+	}else{
+		return 0;
+	}
+	int i;
+	for( i=1; i<longueur; i++ ){
+		if( ( c[i] & 0xC0 ) != 0x80 ) return 0;
+		s = ( s << 6 ) | ( c[i] & 0x3F );
+	}
+	if(
+		s < minimum || s > MAX_SYMBOLE_UNICODE
+		|| ( s >= 0xD800 && s <= 0xDFFF )
+	){
+		return 0;
+	}
+	*symbole = s;
+	*mot += longueur;
+	return 1;
+}
+
+int le_mot_utf8_est_reconnu_intervalles(
+	const Automate_intervalles * automate, const char * mot
+){
+	Ensemble * courants = copier_ensemble( automate->initiaux );
+	const char * c = mot;
+	uint32_t symbole;
+	while( *c && taille_ensemble( courants ) ){
+		if( ! decoder_utf8( &c, &symbole ) ){
+			vider_ensemble( courants );
+			break;
+		}
+		Ensemble * suivants = creer_ensemble( NULL, NULL, NULL );
+		Ensemble_iterateur it;
+		for(
+			it = premier_iterateur_ensemble( courants );
+			! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
+		){
+			ajouter_elements(
+				suivants, voisins_symbole( automate, get_element( it ), symbole )
+			);
+		}
+		liberer_ensemble( courants );
+		courants = suivants;
+	}
+	Ensemble * finaux = creer_intersection_ensemble( courants, automate->finaux );
+	int res = ( *c == '\0' ) && taille_ensemble( finaux ) > 0;
+	liberer_ensemble( finaux );
+	liberer_ensemble( courants );
+	return res;
+}
+
+/*
+ * Écrit l'encodage UTF-8 de 's' dans 'octets' et renvoie sa longueur.
+ */
+int encoder_utf8( uint32_t s, unsigned char * octets ){
+	if( s < 0x80 ){
+		octets[0] = s;
+		return 1;
+	}
+	if( s < 0x800 ){
+		octets[0] = 0xC0 | ( s >> 6 );
+		octets[1] = 0x80 | ( s & 0x3F );
+		return 2;
+	}
+	if( s < 0x10000 ){
+		octets[0] = 0xE0 | ( s >> 12 );
+		octets[1] = 0x80 | ( ( s >> 6 ) & 0x3F );
+		octets[2] = 0x80 | ( s & 0x3F );
+		return 3;
+	}
+	octets[0] = 0xF0 | ( s >> 18 );
+	octets[1] = 0x80 | ( ( s >> 12 ) & 0x3F );
+	octets[2] = 0x80 | ( ( s >> 6 ) & 0x3F );
+	octets[3] = 0x80 | ( s & 0x3F );
+	return 4;
+}
+
+typedef struct {
+	Automate_intervalles * octets;
+	int prochain_etat; // premier état libre pour les chemins intermédiaires
+} Abaissement;
+
+/*
+ * Ajoute, de 'origine' vers chacun des états de 'arrivees', les chemins qui
+ * lisent l'encodage UTF-8 des symboles de [a, b].
+ *
+ * On découpe [a, b] jusqu'à ce que ses symboles aient tous la même longueur
+ * d'encodage et que, à chaque position, les octets de a et de b bornent
+ * exactement les octets possibles : l'intervalle est alors lu par une suite
+ * d'intervalles d'octets.
+ */
+void abaisser_intervalle_utf8(
+	Abaissement * ab, int origine, uint32_t a, uint32_t b,
+	const Ensemble * arrivees
+){
+	static const uint32_t limites[] = { 0x7F, 0x7FF, 0xFFFF };
+	int i;
+	if( a > b ) return;
+	if( b > MAX_SYMBOLE_UNICODE ) b = MAX_SYMBOLE_UNICODE;
+	if( a > MAX_SYMBOLE_UNICODE ) return;
+	// Les surrogates n'ont pas d'encodage UTF-8.
+	if( a <= 0xDFFF && b >= 0xD800 ){
+		if( a < 0xD800 ){
+			abaisser_intervalle_utf8( ab, origine, a, 0xD7FF, arrivees );
+		}
+		if( b > 0xDFFF ){
+			abaisser_intervalle_utf8( ab, origine, 0xE000, b, arrivees );
+		}
+		return;
+	}
+	for( i=0; i<3; i++ ){
+		if( a <= limites[i] && b > limites[i] ){
+			abaisser_intervalle_utf8( ab, origine, a, limites[i], arrivees );
+			abaisser_intervalle_utf8( ab, origine, limites[i] + 1, b, arrivees );
+			return;
+		}
+	}
+	unsigned char debut[4], fin[4];
+	int longueur = encoder_utf8( a, debut );
+	encoder_utf8( b, fin );
+	for( i=1; i<longueur; i++ ){
+		uint32_t masque = ( 1u << ( 6 * i ) ) - 1;
+		if( ( a & ~masque ) != ( b & ~masque ) ){
+			if( ( a & masque ) != 0 ){
+				abaisser_intervalle_utf8( ab, origine, a, a | masque, arrivees );
+				abaisser_intervalle_utf8(
+					ab, origine, ( a | masque ) + 1, b, arrivees
+				);
+				return;
+			}
+			if( ( b & masque ) != masque ){
+				abaisser_intervalle_utf8(
+					ab, origine, a, ( b & ~masque ) - 1, arrivees
+				);
+				abaisser_intervalle_utf8(
+					ab, origine, b & ~masque, b, arrivees
+				);
+				return;
+			}
+		}
+	}
+	int courant = origine;
+	for( i=0; i<longueur-1; i++ ){
+		int suivant = ab->prochain_etat++;
+		ajouter_transition_intervalle(
+			ab->octets, courant, debut[i], fin[i], suivant
+		);
+		courant = suivant;
+	}
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( arrivees );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_transition_intervalle(
+			ab->octets, courant, debut[i], fin[i], get_element( it )
+		);
+	}
+}
+
+Automate_intervalles * abaisser_utf8( const Automate_intervalles * automate ){
+	Abaissement ab;
+	ab.octets = creer_automate_intervalles();
+	ab.prochain_etat = 0;
+	ajouter_elements( ab.octets->etats, automate->etats );
+	ajouter_elements( ab.octets->initiaux, automate->initiaux );
+	ajouter_elements( ab.octets->finaux, automate->finaux );
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( automate->etats );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		if( get_element( it ) >= ab.prochain_etat ){
+			ab.prochain_etat = get_element( it ) + 1;
+		}
+	}
+	Table_iterateur it_table;
+	for(
+		it_table = premier_iterateur_table( automate->segments );
+		! iterateur_est_vide( it_table );
+		it_table = iterateur_suivant_table( it_table )
+	){
+		const Segments * segments = (const Segments *) get_valeur( it_table );
+		int i;
+		for( i=0; i<segments->nb; i++ ){
+			abaisser_intervalle_utf8(
+				&ab, get_cle( it_table ),
+				segments->debut[i], segments->fin[i], segments->arrivees[i]
+			);
+		}
+	}
+	return ab.octets;
+}
@@ -0,0 +1,268 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file intervalles.h */
+
+#ifndef __INTERVALLES_H__
+#define __INTERVALLES_H__
+
+#include "automate.h"
+#include "automate_dense.h"
+
+#include <stdint.h>
+
+/**
+ * @brief Le plus grand symbole Unicode.
+ */
+#define MAX_SYMBOLE_UNICODE 0x10FFFF
+
+/**
+ * @brief Le type d'un automate dont les transitions sont étiquetées par des
+ *        intervalles de lettres.
+ *
+ * Une règle comme « toute lettre sauf le retour à la ligne » coûte une seule
+ * transition, là où un Automate en stocke 255.
+ *
+ * Les transitions sortant d'un état sont rangées en segments disjoints,
+ * triés par première lettre : chaque segment [debut, fin] est associé à
+ * l'ensemble des états atteints par n'importe laquelle de ses lettres. Les
+ * successeurs d'un état par une lettre se trouvent donc par recherche
+ * dichotomique parmi ses segments.
+ *
+ * Les étiquettes sont des symboles de 32 bits : les lettres (voir
+ * ajouter_transition_intervalle()) sont les symboles 0 à 255, comparées
+ * comme des octets non signés, et les points de code Unicode peuvent être
+ * utilisés directement (voir ajouter_transition_symboles()). Un automate
+ * sur les points de code se ramène à un automate sur les octets de leur
+ * encodage UTF-8 avec abaisser_utf8().
+ */
+typedef struct Automate_intervalles Automate_intervalles;
+
+/**
+ * @brief Crée un automate à intervalles vide.
+ *
+ * @return L'automate créé.
+ */
+Automate_intervalles * creer_automate_intervalles();
+
+/**
+ * @brief Détruit un automate à intervalles.
+ *
+ * @param automate L'automate à détruire.
+ */
+void liberer_automate_intervalles( Automate_intervalles * automate );
+
+/**
+ * @brief Ajoute un état à un automate à intervalles.
+ *
+ * @param automate Un automate à intervalles.
+ * @param etat L'état à ajouter.
+ */
+void ajouter_etat_intervalles( Automate_intervalles * automate, int etat );
+
+/**
+ * @brief Ajoute un état initial à un automate à intervalles.
+ *
+ * @param automate Un automate à intervalles.
+ * @param etat L'état à rendre initial.
+ */
+void ajouter_etat_initial_intervalles(
+	Automate_intervalles * automate, int etat
+);
+
+/**
+ * @brief Ajoute un état final à un automate à intervalles.
+ *
+ * @param automate Un automate à intervalles.
+ * @param etat L'état à rendre final.
+ */
+void ajouter_etat_final_intervalles( Automate_intervalles * automate, int etat );
+
+/**
+ * @brief Ajoute les transitions de 'origine' vers 'fin' par toutes les
+ *        lettres comprises entre 'debut_lettre' et 'fin_lettre' (incluses).
+ *
+ * Les segments existants qui chevauchent l'intervalle sont découpés, si
+ * bien que les segments de l'état restent disjoints. L'intervalle est vide
+ * si 'debut_lettre' est plus grand que 'fin_lettre' (en octets non signés).
+ * Les états 'origine' et 'fin' sont ajoutés à l'automate.
+ *
+ * @param automate Un automate à intervalles.
+ * @param origine L'origine des transitions.
+ * @param debut_lettre La première lettre de l'intervalle.
+ * @param fin_lettre La dernière lettre de l'intervalle.
+ * @param fin La fin des transitions.
+ */
+void ajouter_transition_intervalle(
+	Automate_intervalles * automate, int origine,
+	char debut_lettre, char fin_lettre, int fin
+);
+
+/**
+ * @brief Ajoute les transitions de 'origine' vers 'fin' par tous les
+ *        symboles compris entre 'debut_symbole' et 'fin_symbole' (inclus).
+ *
+ * Comme ajouter_transition_intervalle(), pour des symboles de 32 bits.
+ *
+ * @param automate Un automate à intervalles.
+ * @param origine L'origine des transitions.
+ * @param debut_symbole Le premier symbole de l'intervalle.
+ * @param fin_symbole Le dernier symbole de l'intervalle.
+ * @param fin La fin des transitions.
+ */
+void ajouter_transition_symboles(
+	Automate_intervalles * automate, int origine,
+	uint32_t debut_symbole, uint32_t fin_symbole, int fin
+);
+
+/**
+ * @brief Renvoie l'ensemble des états atteints depuis 'origine' en lisant
+ *        le symbole 'symbole'.
+ *
+ * La recherche est dichotomique parmi les segments de 'origine'.
+ * La mémoire de l'ensemble renvoyé est gérée par l'automate.
+ *
+ * @param automate Un automate à intervalles.
+ * @param origine Un état.
+ * @param symbole Un symbole.
+ * @return Les états atteints.
+ */
+const Ensemble * voisins_symbole(
+	const Automate_intervalles * automate, int origine, uint32_t symbole
+);
+
+/**
+ * @brief Renvoie l'ensemble des états atteints depuis 'origine' en lisant
+ *        'lettre'.
+ *
+ * La recherche est dichotomique parmi les segments de 'origine'.
+ * La mémoire de l'ensemble renvoyé est gérée par l'automate.
+ *
+ * @param automate Un automate à intervalles.
+ * @param origine Un état.
+ * @param lettre Une lettre.
+ * @return Les états atteints.
+ */
+const Ensemble * voisins_intervalles(
+	const Automate_intervalles * automate, int origine, char lettre
+);
+
+/**
+ * @brief Renvoie le nombre de segments sortant d'un état.
+ *
+ * @param automate Un automate à intervalles.
+ * @param origine Un état.
+ * @return Le nombre de segments.
+ */
+int nombre_de_segments( const Automate_intervalles * automate, int origine );
+
+/**
+ * @brief Renvoie 1 si le mot est reconnu par l'automate à intervalles,
+ *        0 sinon.
+ *
+ * @param automate Un automate à intervalles.
+ * @param mot Un mot.
+ * @return 1 si le mot est reconnu, 0 sinon.
+ */
+int le_mot_est_reconnu_intervalles(
+	const Automate_intervalles * automate, const char * mot
+);
+
+/**
+ * @brief Renvoie 1 si le texte UTF-8 'mot', lu comme une suite de points de
+ *        code, est reconnu par l'automate à intervalles, 0 sinon.
+ *
+ * Un texte dont l'encodage UTF-8 est invalide n'est pas reconnu.
+ * Cette fonction décode le texte au fil de la lecture ; pour lire beaucoup
+ * de textes, il vaut mieux compiler l'automate abaissé (voir
+ * abaisser_utf8()), qui lit directement les octets.
+ *
+ * @param automate Un automate à intervalles sur les points de code.
+ * @param mot Un texte encodé en UTF-8.
+ * @return 1 si le texte est reconnu, 0 sinon.
+ */
+int le_mot_utf8_est_reconnu_intervalles(
+	const Automate_intervalles * automate, const char * mot
+);
+
+/**
+ * @brief Abaisse un automate sur les points de code Unicode en un automate
+ *        sur les octets, qui lit leur encodage UTF-8.
+ *
+ * Chaque intervalle de points de code est découpé en suites d'intervalles
+ * d'octets, lues par de nouveaux états numérotés après le plus grand état
+ * de l'automate ; les états de l'automate sont conservés. L'automate créé
+ * reconnaît exactement les encodages UTF-8 valides des mots reconnus : les
+ * surrogates et les symboles au-delà de MAX_SYMBOLE_UNICODE sont écartés.
+ *
+ * Le résultat peut être compilé (voir compiler_automate_intervalles()) ou
+ * converti (voir intervalles_vers_automate()) pour les recherches rapides
+ * sur les octets, par exemple compiler_motifs() : le texte UTF-8 est alors
+ * lu sans passe de décodage.
+ *
+ * @param automate Un automate à intervalles sur les points de code.
+ * @return L'automate à intervalles créé, sur les octets.
+ */
+Automate_intervalles * abaisser_utf8( const Automate_intervalles * automate );
+
+/**
+ * @brief Convertit un automate en automate à intervalles.
+ *
+ * Les lettres consécutives qui mènent d'un même état au même ensemble
+ * d'états sont regroupées en un seul segment. Les transitions vers l'état
+ * puits implicite (voir complementer()) sont rendues
+ * explicites.
+ *
+ * @param automate Un automate.
+ * @return L'automate à intervalles créé.
+ */
+Automate_intervalles * automate_vers_intervalles( const Automate * automate );
+
+/**
+ * @brief Convertit un automate à intervalles en automate, avec une
+ *        transition par lettre.
+ *
+ * L'alphabet de l'automate créé est l'ensemble des lettres qui étiquettent
+ * au moins une transition. Les symboles doivent être des octets (voir
+ * abaisser_utf8()).
+ *
+ * @param automate Un automate à intervalles.
+ * @return L'automate créé.
+ */
+Automate * intervalles_vers_automate( const Automate_intervalles * automate );
+
+/**
+ * @brief Compile un automate à intervalles en automate déterministe dense.
+ *
+ * Les bornes des intervalles découpent les octets en segments élémentaires,
+ * qui ne sont jamais séparés par une transition : l'automate est déterminisé
+ * sur une seule lettre représentante par segment, puis la table des
+ * colonnes de l'automate compilé est étendue à toutes les lettres. Aucune
+ * transition par lettre n'est donc créée. Les symboles doivent être des
+ * octets (voir abaisser_utf8()).
+ *
+ * @param automate Un automate à intervalles.
+ * @return L'automate compilé, comme le renvoie compiler_automate().
+ */
+Automate_dense * compiler_automate_intervalles(
+	const Automate_intervalles * automate
+);
+
+#endif
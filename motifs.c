@@ -0,0 +1,222 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "motifs.h"
+#include "automate.h"
+#include "ensemble.h"
+#include "table.h"
+#include "outils.h"
+
+#include <string.h>
+#include <limits.h>
+
+#include <assert.h>
+
+struct Motifs {
+	Automate * automate;
+	Table * motifs_finaux; // état final -> Ensemble des identifiants
+	int nb_motifs;
+	Ensemble * vide;
+	int * distances; // indice d'un état -> distance au plus proche état final
+	int distance_initiale; // plus petite distance d'un état initial
+};
+
+/*
+ * Ajoute l'identifiant 'motif' à l'ensemble des motifs de l'état final 'etat'.
+ */
+void ajouter_motif_final( Motifs * motifs, int etat, int motif ){
+	Table_iterateur it = trouver_table( motifs->motifs_finaux, etat );
+	Ensemble * ens;
+	if( iterateur_est_vide( it ) ){
+		ens = creer_ensemble( NULL, NULL, NULL );
+		add_table( motifs->motifs_finaux, etat, (intptr_t) ens );
+	}else{
+		ens = (Ensemble*) get_valeur( it );
+	}
+	ajouter_element( ens, motif );
+}
+
+Motifs * compiler_motifs( const Automate ** automates, int nb_automates ){
+	Motifs * motifs = xmalloc( sizeof(Motifs) );
+	motifs->motifs_finaux = creer_table( NULL, NULL, NULL );
+	motifs->nb_motifs = nb_automates;
+	motifs->vide = creer_ensemble( NULL, NULL, NULL );
+
+	// L'union translate chaque motif dans son propre intervalle d'états ;
+	// il reste à retrouver, pour chaque état final, le motif d'origine.
+	int * translations = xmalloc( ( nb_automates + 1 ) * sizeof(int) );
+	motifs->automate = creer_union_de_n_automates(
+		automates, nb_automates, translations
+	);
+	int i;
+	for( i=0; i<nb_automates; i++ ){
+		Ensemble_iterateur it;
+		for(
+			it = premier_iterateur_ensemble( get_finaux( automates[i] ) );
+			! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
+		){
+			ajouter_motif_final( motifs, get_element( it ) + translations[i], i );
+		}
+	}
+	xfree( translations );
+
+	motifs->distances = creer_distances_aux_etats_finaux( motifs->automate );
+	motifs->distance_initiale = INT_MAX;
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( get_initiaux( motifs->automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		int distance = motifs->distances[
+			indice_de_l_etat( motifs->automate, get_element( it ) )
+		];
+		if( distance >= 0 && distance < motifs->distance_initiale ){
+			motifs->distance_initiale = distance;
+		}
+	}
+	return motifs;
+}
+
+void liberer_motifs( Motifs * motifs ){
+	assert( motifs );
+	pour_toute_valeur_table(
+		motifs->motifs_finaux, ( void(*)(intptr_t) ) liberer_ensemble
+	);
+	liberer_table( motifs->motifs_finaux );
+	xfree( motifs->distances );
+	liberer_automate( motifs->automate );
+	liberer_ensemble( motifs->vide );
+	xfree( motifs );
+}
+
+int nombre_de_motifs( const Motifs * motifs ){
+	return motifs->nb_motifs;
+}
+
+const Automate * get_automate_des_motifs( const Motifs * motifs ){
+	return motifs->automate;
+}
+
+const Ensemble * get_motifs_de_l_etat( const Motifs * motifs, int etat ){
+	Table_iterateur it = trouver_table( motifs->motifs_finaux, etat );
+	if( iterateur_est_vide( it ) ){
+		return motifs->vide;
+	}
+	return (const Ensemble*) get_valeur( it );
+}
+
+/*
+ * Rassemble dans 'trouves' les identifiants des motifs terminés par l'un des
+ * états de 'courants'.
+ */
+void motifs_trouves(
+	const Motifs * motifs, const Ensemble * courants, Ensemble * trouves
+){
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( courants );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		Table_iterateur it_motifs = trouver_table(
+			motifs->motifs_finaux, get_element( it )
+		);
+		if( ! iterateur_est_vide( it_motifs ) ){
+			ajouter_elements( trouves, (Ensemble*) get_valeur( it_motifs ) );
+		}
+	}
+}
+
+/*
+ * Renvoie les états de 'courants' qui peuvent encore atteindre un état final
+ * en lisant au plus 'restant' lettres. 'courants' est libéré.
+ */
+Ensemble * elaguer_etats( const Motifs * motifs, Ensemble * courants, int restant ){
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( courants );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		int distance = motifs->distances[
+			indice_de_l_etat( motifs->automate, get_element( it ) )
+		];
+		if( distance >= 0 && distance <= restant ){
+			ajouter_element( res, get_element( it ) );
+		}
+	}
+	liberer_ensemble( courants );
+	return res;
+}
+
+void chercher_motifs(
+	const Motifs * motifs, const char * texte,
+	void (* action )( int motif, int fin, void* data ),
+	void* data
+){
+	chercher_motifs_binaire( motifs, texte, strlen( texte ), action, data );
+}
+
+void chercher_motifs_binaire(
+	const Motifs * motifs, const char * texte, int len,
+	void (* action )( int motif, int fin, void* data ),
+	void* data
+){
+	const Automate * automate = motifs->automate;
+	int i;
+
+	// On relance la lecture depuis les états initiaux à chaque position :
+	// les facteurs de toutes les positions de départ sont lus en même temps.
+	Ensemble * courants = creer_ensemble( NULL, NULL, NULL );
+	Ensemble * trouves = creer_ensemble( NULL, NULL, NULL );
+	for( i=0; i<=len; i++ ){
+		// Plus aucun motif ne peut se terminer dans ce qui reste du texte.
+		if(
+			taille_ensemble( courants ) == 0
+			&& motifs->distance_initiale > len - i
+		){
+			break;
+		}
+		ajouter_elements( courants, get_initiaux( automate ) );
+		courants = elaguer_etats( motifs, courants, len - i );
+
+		motifs_trouves( motifs, courants, trouves );
+		Ensemble_iterateur it;
+		for(
+			it = premier_iterateur_ensemble( trouves );
+			! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
+		){
+			action( get_element( it ), i, data );
+		}
+		vider_ensemble( trouves );
+
+		if( i < len ){
+			Ensemble * suivants = delta( automate, courants, texte[i] );
+			liberer_ensemble( courants );
+			courants = suivants;
+		}
+	}
+	liberer_ensemble( trouves );
+	liberer_ensemble( courants );
+}
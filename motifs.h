@@ -0,0 +1,133 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file motifs.h */
+
+#ifndef __MOTIFS_H__
+#define __MOTIFS_H__
+
+#include "automate.h"
+
+/**
+ * @brief Le type d'un reconnaisseur de plusieurs motifs.
+ *
+ * Un reconnaisseur regroupe N automates (les motifs) dans un unique automate.
+ * Chaque état final de cet automate connaît l'ensemble des identifiants des
+ * motifs qu'il termine, ce qui permet de chercher tous les motifs en une seule
+ * lecture du texte.
+ *
+ * L'identifiant d'un motif est son indice dans le tableau passé à
+ * compiler_motifs().
+ */
+typedef struct Motifs Motifs;
+
+/**
+ * @brief Compile un tableau d'automates en un reconnaisseur de motifs.
+ *
+ * Les automates passés en paramètre ne sont pas modifiés et restent à la
+ * charge de l'utilisateur.
+ *
+ * @param automates Un tableau d'automates.
+ * @param nb_automates Le nombre d'automates du tableau.
+ * @return Le reconnaisseur créé.
+ */
+Motifs * compiler_motifs( const Automate ** automates, int nb_automates );
+
+/**
+ * @brief Détruit un reconnaisseur de motifs.
+ *
+ * @param motifs Le reconnaisseur à détruire.
+ */
+void liberer_motifs( Motifs * motifs );
+
+/**
+ * @brief Renvoie le nombre de motifs du reconnaisseur.
+ *
+ * @param motifs Un reconnaisseur.
+ * @return Le nombre de motifs.
+ */
+int nombre_de_motifs( const Motifs * motifs );
+
+/**
+ * @brief Renvoie l'automate qui regroupe tous les motifs.
+ *
+ * La mémoire de l'automate renvoyé est gérée par le reconnaisseur.
+ *
+ * @param motifs Un reconnaisseur.
+ * @return L'automate des motifs.
+ */
+const Automate * get_automate_des_motifs( const Motifs * motifs );
+
+/**
+ * @brief Renvoie l'ensemble des identifiants des motifs reconnus dans un
+ *        état de l'automate des motifs.
+ *
+ * L'ensemble est vide si l'état n'est pas final.
+ * La mémoire de l'ensemble renvoyé est gérée par le reconnaisseur.
+ *
+ * @param motifs Un reconnaisseur.
+ * @param etat Un état de l'automate des motifs.
+ * @return L'ensemble des identifiants.
+ */
+const Ensemble * get_motifs_de_l_etat( const Motifs * motifs, int etat );
+
+/**
+ * @brief Cherche tous les motifs dans un texte, en une seule lecture.
+ *
+ * Un motif est trouvé en position 'fin' s'il existe un facteur du texte
+ * reconnu par le motif et se terminant juste avant le caractère numéro 'fin'
+ * ('fin' est donc compris entre 0 et la longueur du texte).
+ * Pour chaque position, chaque motif trouvé n'est signalé qu'une seule fois,
+ * quel que soit le nombre de facteurs qui le reconnaissent ; les motifs sont
+ * signalés par position croissante, puis par identifiant croissant.
+ *
+ * La fonction qui sera executée doit posséder l'en-tête suivante :
+ *   void NOM_FONCTION( int motif, int fin, void* data );
+ *
+ * @param motifs Un reconnaisseur.
+ * @param texte Le texte à parcourir.
+ * @param action La fonction à exécuter pour chaque motif trouvé.
+ * @param data La donnée supplémentaire à passer en paramètre à la fonction
+ *             'action'.
+ */
+void chercher_motifs(
+	const Motifs * motifs, const char * texte,
+	void (* action )( int motif, int fin, void* data ),
+	void* data
+);
+
+/**
+ * @brief Comme chercher_motifs(), pour un texte de longueur donnée pouvant
+ *        contenir le caractère nul.
+ *
+ * @param motifs Un reconnaisseur.
+ * @param texte Le texte à parcourir.
+ * @param longueur Le nombre de caractères du texte.
+ * @param action La fonction à exécuter pour chaque motif trouvé.
+ * @param data La donnée supplémentaire à passer en paramètre à la fonction
+ *             'action'.
+ */
+void chercher_motifs_binaire(
+	const Motifs * motifs, const char * texte, int longueur,
+	void (* action )( int motif, int fin, void* data ),
+	void* data
+);
+
+#endif
@@ -22,6 +22,7 @@
 #include "outils.h"
 
 #include <stdlib.h>
+#include <stdatomic.h>
 
 int test( int result, int ligne ){
 	if( ! result ){
@@ -31,7 +32,21 @@ int test( int result, int ligne ){
 	return 0;
 }
 
+// Les compteurs sont atomiques : les allocations peuvent venir de plusieurs
+// fils d'exécution.
+static atomic_ulong allocations = 0;
+static atomic_ulong liberations = 0;
+
+unsigned long nombre_d_allocations(){
+	return allocations;
+}
+
+unsigned long nombre_de_liberations(){
+	return liberations;
+}
+
 void* xmalloc( size_t n ){
+	allocations++;
 	void* result = malloc( n );
 	if( ! result ){
 		ERREUR( "Espace insuffisant" );
@@ -39,6 +54,16 @@ void* xmalloc( size_t n ){
 	return result;
 }
 
+void* xrealloc( void* ptr, size_t n ){
+	if( ! ptr ) allocations++;
+	void* result = realloc( ptr, n );
+	if( ! result ){
+		ERREUR( "Espace insuffisant" );
+	}
+	return result;
+}
+
 void xfree( void* ptr ){
+	if( ptr ) liberations++;
 	free(ptr);
 }
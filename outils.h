@@ -30,8 +30,18 @@
 #define ERREUR(x) do { fprintf(stderr,"ERREUR : %s - ligne : %d, fichier : %s\n", (x), __LINE__, __FILE__ ); exit(EXIT_FAILURE); } while(0)
 
 void* xmalloc( size_t n );
+void* xrealloc( void* ptr, size_t n );
 void xfree( void* ptr );
 
+/*
+ * Compteurs des appels à xmalloc() (et à xrealloc() sur un pointeur nul) et
+ * des appels à xfree() sur un pointeur non nul, depuis le lancement du
+ * programme. Ils servent aux tests qui vérifient qu'une fonction ne fuit
+ * pas et ne gaspille pas d'allocations.
+ */
+unsigned long nombre_d_allocations();
+unsigned long nombre_de_liberations();
+
 #define TEST(y,x) do { x &= (y); if(!(y)){ fprintf(stdout, "\033[31mEchec du test %s() -- ligne : %d, fichier : %s\033[0m\n", __FUNCTION__, __LINE__, __FILE__ ); } } while(0)
 #define TEST1(x) test( x, __LINE__)
 
@@ -28,10 +28,12 @@
 #include <search.h>
 #include <stdlib.h>
 
+/*
+ * Une association est rangée dans le nœud de l'arbre qui la contient (voir
+ * avl_set_item_size()) : les fonctions de gestion des clés sont celles de la
+ * table, passée en paramètre aux fonctions de l'arbre.
+ */
 typedef struct Table_association {
-	void (*supprimer_cle)(intptr_t cle);
-	intptr_t (*copier_cle)(const intptr_t cle);
-	int (*comparer_cle)(const intptr_t cle1, const intptr_t cle2);
 	intptr_t cle;
 	intptr_t valeur;
 } Table_association ;
@@ -54,64 +56,60 @@ intptr_t get_valeur( Table_iterateur it ){
 	return asso->valeur;
 }
 
-Table_association * creer_table_association(
-	const Table* table, const intptr_t cle, intptr_t valeur
-){
-	Table_association * res = xmalloc(
-		sizeof( Table_association )
-	);
-	if( table->copier_cle && cle ){
-		res->cle = table->copier_cle( cle );
-	}else{
-		res->cle = cle;
-	}
-	res->valeur = valeur;
-	res->supprimer_cle = table->supprimer_cle;
-	res->copier_cle = table->copier_cle;
-	res->comparer_cle = table->comparer_cle;
-	return res;
-}
-
-Table_association * copier_table_association( Table_association * asso ){
-	Table_association * res = xmalloc(
-		sizeof( Table_association )
-	);
-	*res = *asso;
-	if( asso->copier_cle && asso->cle ){
-		res->cle = asso->copier_cle( asso->cle );
-	}
-	return res;
+void set_valeur( Table_iterateur it, intptr_t valeur ){
+	// Les nœuds partagés avec des copies de la table sont d'abord copiés.
+	Table_association * asso = ( Table_association * ) avl_t_own( &it );
+	asso->valeur = valeur;
 }
 
 int compare_table_association( const void * pa1, const void * pb1, void* param ){
-	Table_association * pa = (Table_association *) pa1;
-	Table_association * pb = (Table_association *) pb1;
-	if( pa->comparer_cle ){
-		int r = pa->comparer_cle( pa->cle, pb->cle );
-		return r;
-	}else{
-		if( pa->cle < pb->cle )
-			return -1;
-		if( pa->cle > pb->cle )
-			return 1;
-		return 0;
-	}
+	const Table * table = (const Table *) param;
+	const Table_association * pa = (const Table_association *) pa1;
+	const Table_association * pb = (const Table_association *) pb1;
+	return table->comparer_cle( pa->cle, pb->cle );
 }
 
+int compare_table_association_entiers(
+	const void * pa1, const void * pb1, void* param
+){
+	const Table_association * pa = (const Table_association *) pa1;
+	const Table_association * pb = (const Table_association *) pb1;
+	if( pa->cle < pb->cle )
+		return -1;
+	if( pa->cle > pb->cle )
+		return 1;
+	return 0;
+}
 
-void supprimer_table_association2( void* asso_tmp, void* data ){
+/*
+ * Complète la copie d'une association, déjà recopiée dans son nouveau nœud.
+ */
+void * copier_association_avl( void * asso_tmp, void * param ){
+	const Table * table = (const Table *) param;
 	Table_association * asso = (Table_association*) asso_tmp;
-	if( asso->supprimer_cle && asso->cle ){
-		asso->supprimer_cle( asso->cle );
+	if( table->copier_cle && asso->cle ){
+		asso->cle = table->copier_cle( asso->cle );
 	}
-	xfree(asso);
+	return asso;
 }
 
-void supprimer_table_association( Table_association * asso ){
-	if( asso->supprimer_cle && asso->cle ){
-		asso->supprimer_cle( asso->cle );
+void supprimer_association_avl( void* asso_tmp, void* param ){
+	const Table * table = (const Table *) param;
+	Table_association * asso = (Table_association*) asso_tmp;
+	if( table->supprimer_cle && asso->cle ){
+		table->supprimer_cle( asso->cle );
 	}
-	xfree(asso);
+}
+
+struct avl_table * creer_arbre_de_la_table( Table * table ){
+	struct avl_table * root = avl_create(
+		table->comparer_cle ?
+			compare_table_association : compare_table_association_entiers,
+		table, NULL
+	);
+	avl_set_item_funcs( root, copier_association_avl, supprimer_association_avl );
+	avl_set_item_size( root, sizeof( Table_association ) );
+	return root;
 }
 
 Table* creer_table(
@@ -120,49 +118,78 @@ Table* creer_table(
 	void (*supprimer_cle)(intptr_t cle)
 ){
 	Table* res = xmalloc( sizeof(Table) );
-	res->root = avl_create ( compare_table_association, NULL, NULL );
-
 	res->supprimer_cle = supprimer_cle;
 	res->comparer_cle = comparer_cle;
 	res->copier_cle = copier_cle;
+	res->root = creer_arbre_de_la_table( res );
+	return res;
+}
+
+Table * copier_table(
+	const Table * table,
+	intptr_t (*copier_valeur)( const intptr_t valeur, void* data ), void* data
+){
+	Table * res = xmalloc( sizeof(Table) );
+	*res = *table;
+	if( ! copier_valeur ){
+		res->root = avl_share( table->root );
+		res->root->avl_param = res;
+		return res;
+	}
+	res->root = avl_copy(
+		table->root, copier_association_avl, supprimer_association_avl, NULL
+	);
+	if( ! res->root ){
+		ERREUR( "Espace insuffisant" );
+	}
+	res->root->avl_param = res;
+	struct avl_traverser traverser;
+	void * item;
+	for(
+		item = avl_t_first( &traverser, res->root );
+		item;
+		item = avl_t_next( &traverser )
+	){
+		Table_association * asso = (Table_association *) item;
+		asso->valeur = copier_valeur( asso->valeur, data );
+	}
 	return res;
 }
 
 void liberer_table( Table* table ){
 	assert( table );
-	avl_destroy ( table->root, supprimer_table_association2 );
+	avl_destroy ( table->root, NULL );
 	xfree( table );
 }
 
 void add_table( Table* table, const intptr_t cle, intptr_t valeur ) {
-	Table_association* asso = creer_table_association(table, cle, valeur);
-	void* val = avl_probe ( table->root, (void*) asso );
+	Table_association asso = { cle, valeur };
+	int taille = taille_table( table );
+	void* val = avl_probe ( table->root, (void*) &asso );
 	if( val == NULL ){
 		ERREUR( "Espace insuffisant" );
 	}
 	Table_association* asso_tree = *( Table_association** ) val; 
-	if( asso_tree != asso  ){
-		supprimer_table_association( asso );
+	if( taille_table( table ) != taille ){
+		// La clé n'est copiée que si elle est insérée.
+		if( table->copier_cle && cle ){
+			asso_tree->cle = table->copier_cle( cle );
+		}
+	}else{
 		asso_tree->valeur = valeur;
 	}
 }
 
 intptr_t delete_table( Table* table, intptr_t cle ){
 	intptr_t valeur = (intptr_t) NULL;
-	Table_association* asso_tree = NULL;
-	Table_association* asso = creer_table_association(
-		table, cle, (intptr_t) NULL
-	);
-	void* val = avl_find( table->root, (void*) asso );
+	Table_association asso = { cle, (intptr_t) NULL };
+	void* val = avl_find( table->root, (void*) &asso );
 	if( val ){
-		asso_tree = ( Table_association* ) val; 
-		valeur = asso_tree->valeur;
-	}
-	avl_delete( table->root, (void*) asso );
-	if(asso_tree){
-		supprimer_table_association( asso_tree );
+		// La clé est libérée par l'arbre, sauf si une copie de la table
+		// partage encore le nœud.
+		valeur = ( ( Table_association* ) val )->valeur;
+		avl_delete( table->root, (void*) &asso );
 	}
-	supprimer_table_association( asso );
 	return valeur;
 }
 
@@ -199,8 +226,8 @@ void pour_toute_valeur_table(
 }
 
 void vider_table( Table* table ){
-	avl_destroy ( table->root, supprimer_table_association2 );
-	table->root = avl_create ( compare_table_association, NULL, NULL );
+	avl_destroy ( table->root, NULL );
+	table->root = creer_arbre_de_la_table( table );
 }
 
 typedef struct {
@@ -240,11 +267,8 @@ void print_table(
 
 Table_iterateur trouver_table( const Table* table, intptr_t cle ){
 	Table_iterateur it;
-	Table_association* asso = creer_table_association(
-		table, cle, (intptr_t) NULL
-	);
-	avl_t_find( &it, table->root, (void*) asso );
-	supprimer_table_association( asso );
+	Table_association asso = { cle, (intptr_t) NULL };
+	avl_t_find( &it, table->root, (void*) &asso );
 	return it;
 }
 
@@ -254,9 +278,16 @@ Table_iterateur premier_iterateur_table( const Table* table ){
 	return it;
 }
 
-Table_iterateur dernier_iterateur_table(
-	const Table_iterateur * iterator, Table* table 
+Table_iterateur premier_iterateur_table_a_partir_de(
+	const Table* table, const intptr_t cle
 ){
+	Table_iterateur it;
+	Table_association asso = { cle, (intptr_t) NULL };
+	avl_t_lower_bound( &it, table->root, (void*) &asso );
+	return it;
+}
+
+Table_iterateur dernier_iterateur_table( const Table* table ){
 	Table_iterateur it;
 	avl_t_last( &it, table->root );
 	return it;
@@ -276,15 +307,6 @@ Table_iterateur iterateur_precedent_table( Table_iterateur iterateur ){
 	return iterateur;
 }
 
-int taille_table( Table* t ){
-	int res = 0;
-	Table_iterateur it1;
-	for(
-		it1 = premier_iterateur_table( t );
-		! iterateur_est_vide( it1 );
-		it1 = iterateur_suivant_table( it1 )
-	){
-		res += 1;
-	}
-	return res;
+int taille_table( const Table* t ){
+	return avl_count( t->root );
 };
@@ -160,6 +160,31 @@ Table* creer_table(
  */
 void liberer_table( Table* table );
 
+/**
+ * @brief
+ * Cette fonction crée une copie de la table passée en paramètre, avec les
+ * mêmes fonctions de gestion des clés. Les clés sont copiées comme par
+ * add_table() ; les valeurs sont copiées par la fonction 'copier_valeur',
+ * qui reçoit aussi le paramètre 'data', ou recopiées telles quelles si
+ * 'copier_valeur' vaut NULL.
+ *
+ * Si 'copier_valeur' vaut NULL, la copie se fait en temps constant : les
+ * deux tables partagent leurs nœuds, et une modification de l'une ne
+ * recopie que les O(log n) nœuds du chemin modifié (copie de chemin),
+ * l'autre table restant inchangée. Les nœuds partagés ont un compte de
+ * références atomique : deux tables qui partagent des nœuds peuvent être
+ * modifiées, copiées et libérées par des fils d'exécution différents. Une
+ * même table ne doit pas être modifiée pendant qu'un autre fil la lit ou la
+ * copie.
+ *
+ * Sinon, l'arbre est recopié nœud par nœud, sans aucune comparaison de
+ * clés : la copie se fait en temps linéaire.
+ */
+Table * copier_table(
+	const Table * table,
+	intptr_t (*copier_valeur)( const intptr_t valeur, void* data ), void* data
+);
+
 /**
  * @brief
  * La fonction add_table() ajoute une association entre une clé et une valeur.
@@ -254,6 +279,8 @@ void pour_toute_cle_valeur_table(
  * Renvoie un itérateur positionné sur l'association dont la clé est identique 
  * (pour la fonction de comparaison de clé de la table) à la clé passée en 
  * paramètre.
+ * La clé passée en paramètre n'est pas copiée : la recherche ne fait aucune
+ * allocation.
  */
 Table_iterateur trouver_table( const Table* table, const intptr_t cle );
 
@@ -266,6 +293,25 @@ Table_iterateur trouver_table( const Table* table, const intptr_t cle );
  */
 Table_iterateur premier_iterateur_table( const Table* table );
 
+/**
+ * @brief
+ * Renvoie un itérateur positionné sur la plus petite association dont la clé
+ * est supérieure ou égale à la clé passée en paramètre, ou l'itérateur vide
+ * s'il n'y en a pas.
+ *
+ * Avec iterateur_suivant_table(), cela permet de parcourir les associations
+ * dont les clés sont dans un intervalle sans parcourir toute la table.
+ */
+Table_iterateur premier_iterateur_table_a_partir_de(
+	const Table* table, const intptr_t cle
+);
+
+/**
+ * @brief
+ * Renvoie un itérateur positionné sur la dernière association de la table.
+ */
+Table_iterateur dernier_iterateur_table( const Table* table );
+
 /**
  * @brief
  * Renvoie l'itérateur suivant.
@@ -317,10 +363,18 @@ intptr_t get_cle( Table_iterateur it );
  */
 intptr_t get_valeur( Table_iterateur it );
 
+/**
+ * @brief
+ * Remplace la valeur de l'association pointée par l'itérateur passé en
+ * paramètre, sans rechercher la clé. Si la table partage des nœuds avec une
+ * copie (voir copier_table()), le chemin de l'association est recopié.
+ */
+void set_valeur( Table_iterateur it, intptr_t valeur );
+
 /**
  * @brief
  * Renvoie la taille de la table.
  */
-int taille_table( Table* t );
+int taille_table( const Table* t );
 
 #endif
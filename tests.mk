@@ -1,11 +1,34 @@
-tests/test_miroir: tests/test_miroir.o libautomate.a
-tests/test_delta_delta_star: tests/test_delta_delta_star.o libautomate.a
+tests/test_ajouter_transitions: tests/test_ajouter_transitions.o libautomate.a
+tests/test_allocations: tests/test_allocations.o libautomate.a
 tests/test_automate_accessible: tests/test_automate_accessible.o libautomate.a
-tests/test_translater_etat: tests/test_translater_etat.o libautomate.a
-tests/test_get_max_etat: tests/test_get_max_etat.o libautomate.a
-tests/test_creer_automate: tests/test_creer_automate.o libautomate.a
+tests/test_automate_du_melange: tests/test_automate_du_melange.o libautomate.a
 tests/test_automate_vide: tests/test_automate_vide.o libautomate.a
+tests/test_binaire: tests/test_binaire.o libautomate.a
+tests/test_classes_de_lettres: tests/test_classes_de_lettres.o libautomate.a
+tests/test_co_accessibles: tests/test_co_accessibles.o libautomate.a
+tests/test_complementer: tests/test_complementer.o libautomate.a
+tests/test_copier_automate: tests/test_copier_automate.o libautomate.a
+tests/test_copies_concurrentes: tests/test_copies_concurrentes.o libautomate.a
+tests/test_creer_automate: tests/test_creer_automate.o libautomate.a
+tests/test_delta_delta_star: tests/test_delta_delta_star.o libautomate.a
 tests/test_ensemble: tests/test_ensemble.o libautomate.a
-tests/test_automate_du_melange: tests/test_automate_du_melange.o libautomate.a
+tests/test_enumeration: tests/test_enumeration.o libautomate.a
+tests/test_equivalence: tests/test_equivalence.o libautomate.a
+tests/test_generation: tests/test_generation.o libautomate.a
+tests/test_get_max_etat: tests/test_get_max_etat.o libautomate.a
+tests/test_intersection: tests/test_intersection.o libautomate.a
+tests/test_intervalles: tests/test_intervalles.o libautomate.a
+tests/test_miroir: tests/test_miroir.o libautomate.a
+tests/test_motifs: tests/test_motifs.o libautomate.a
+tests/test_nombre_de_mots: tests/test_nombre_de_mots.o libautomate.a
+tests/test_partage_des_arrivees: tests/test_partage_des_arrivees.o libautomate.a
+tests/test_plus_court_mot: tests/test_plus_court_mot.o libautomate.a
+tests/test_predecesseurs: tests/test_predecesseurs.o libautomate.a
+tests/test_renumerotation: tests/test_renumerotation.o libautomate.a
+tests/test_retirer: tests/test_retirer.o libautomate.a
 tests/test_table: tests/test_table.o libautomate.a
+tests/test_translater_etat: tests/test_translater_etat.o libautomate.a
+tests/test_union: tests/test_union.o libautomate.a
+tests/test_utf8: tests/test_utf8.o libautomate.a
+tests/test_vue: tests/test_vue.o libautomate.a
 
@@ -0,0 +1,137 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "outils.h"
+
+typedef struct {
+	const Automate * autre;
+	int nb;
+	int identiques;
+} Comparaison;
+
+void action_comparer_transitions( int origine, char lettre, int fin, void* data ){
+	Comparaison * c = (Comparaison*) data;
+	c->nb++;
+	if( ! est_une_transition_de_l_automate( c->autre, origine, lettre, fin ) ){
+		c->identiques = 0;
+	}
+}
+
+/*
+ * Renvoie 1 si les deux automates ont exactement les mêmes transitions.
+ */
+int memes_transitions( const Automate * a, const Automate * b ){
+	Comparaison ab = { b, 0, 1 };
+	Comparaison ba = { a, 0, 1 };
+	pour_toute_transition( a, action_comparer_transitions, &ab );
+	pour_toute_transition( b, action_comparer_transitions, &ba );
+	return ab.identiques && ba.identiques && ab.nb == ba.nb;
+}
+
+int test_ajouter_transitions(){
+
+	int result = 1;
+
+	{
+		// Des transitions en double, déjà présentes, ou qui complètent un
+		// ensemble d'arrivée existant.
+		Automate * automate = mot_to_automate( "ab" );
+		Automate * attendu = mot_to_automate( "ab" );
+		Transition transitions[] = {
+			{ 5, 'c', 0 }, { 0, 'a', 1 }, { 0, 'a', 3 }, { 5, 'c', 0 },
+			{ 1, 'b', 2 }, { -2, '\377', 5 }, { 0, 'a', 3 }
+		};
+		int nb = sizeof(transitions) / sizeof(Transition);
+		int i;
+		for( i=0; i<nb; i++ ){
+			ajouter_transition(
+				attendu, transitions[i].origine, transitions[i].lettre,
+				transitions[i].fin
+			);
+		}
+		ajouter_transitions( automate, transitions, nb );
+
+		TEST(
+			1
+			&& memes_transitions( automate, attendu )
+			&& taille_ensemble( get_etats( automate ) ) == 6
+			&& taille_ensemble( get_alphabet( automate ) ) == 4
+			&& est_une_lettre_de_l_automate( automate, '\377' )
+			&& est_une_transition_de_l_automate( automate, 0, 'a', 3 )
+			&& get_min_etat( automate ) == -2
+			&& get_max_etat( automate ) == 5
+			// Les nouveaux états suivent les anciens, dans l'ordre croissant.
+			&& indice_de_l_etat( automate, -2 ) == 3
+			&& indice_de_l_etat( automate, 3 ) == 4
+			&& indice_de_l_etat( automate, 5 ) == 5
+			&& le_mot_est_reconnu( automate, "ab" )
+			&& ! le_mot_est_reconnu( automate, "a" )
+			, result
+		);
+
+		// Le tableau a été trié.
+		int trie = 1;
+		for( i=1; i<nb; i++ ){
+			if( transitions[i-1].origine > transitions[i].origine ) trie = 0;
+		}
+		TEST( trie, result );
+
+		liberer_automate( automate );
+		liberer_automate( attendu );
+	}
+
+	{
+		// Un ajout vide ne change rien.
+		Automate * automate = mot_to_automate( "a" );
+		ajouter_transitions( automate, NULL, 0 );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( automate ) ) == 2
+			&& le_mot_est_reconnu( automate, "a" )
+			, result
+		);
+		liberer_automate( automate );
+	}
+
+	{
+		// Les caches sont invalidés.
+		Automate * automate = mot_to_automate( "a" );
+		ajouter_etat( automate, 7 );
+		int avant = est_dans_l_ensemble( etats_co_accessibles( automate ), 7 );
+		Transition transitions[] = { { 7, 'a', 1 } };
+		ajouter_transitions( automate, transitions, 1 );
+		int apres = est_dans_l_ensemble( etats_co_accessibles( automate ), 7 );
+		TEST( ! avant && apres, result );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_ajouter_transitions() ){ return 1; }
+
+	return 0;
+}
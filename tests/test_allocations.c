@@ -0,0 +1,174 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "outils.h"
+
+#define NB_TRANSITIONS 1000
+
+/*
+ * Le nombre d'allocations encore vivantes.
+ */
+long allocations_vivantes(){
+	return (long) nombre_d_allocations() - (long) nombre_de_liberations();
+}
+
+typedef struct {
+	const Automate * autre;
+	int nb;
+	int identiques;
+} Comparaison;
+
+void action_comparer_transitions( int origine, char lettre, int fin, void* data ){
+	Comparaison * c = (Comparaison*) data;
+	c->nb++;
+	if( ! est_une_transition_de_l_automate( c->autre, origine, lettre, fin ) ){
+		c->identiques = 0;
+	}
+}
+
+/*
+ * Renvoie 1 si les deux automates ont exactement les mêmes transitions.
+ */
+int memes_transitions( const Automate * a, const Automate * b ){
+	Comparaison ab = { b, 0, 1 };
+	Comparaison ba = { a, 0, 1 };
+	pour_toute_transition( a, action_comparer_transitions, &ab );
+	pour_toute_transition( b, action_comparer_transitions, &ba );
+	return ab.identiques && ba.identiques && ab.nb == ba.nb;
+}
+
+int test_allocations(){
+
+	int result = 1;
+
+	Transition transitions[NB_TRANSITIONS];
+	int i;
+	for( i=0; i<NB_TRANSITIONS; i++ ){
+		// Des doublons, des états absents de l'ensemble des états et des
+		// lettres absentes de l'alphabet.
+		transitions[i].origine = ( i * 7 ) % 101;
+		transitions[i].lettre = 'a' + i % 5;
+		transitions[i].fin = ( i * 13 ) % 103;
+	}
+
+	{
+		// Le constructeur alloue moins que l'ajout transition par transition,
+		// pour le même nombre d'allocations vivantes à l'arrivée : il ne
+		// libère que son tableau de travail et les ensembles d'arrivée
+		// remplacés par un ensemble partagé.
+		long vivantes = allocations_vivantes();
+		unsigned long allocations = nombre_d_allocations();
+		unsigned long liberations = nombre_de_liberations();
+
+		Ensemble * etats = creer_ensemble( NULL, NULL, NULL );
+		ajouter_element( etats, 0 );
+		ajouter_element( etats, 500 );
+		Ensemble * initiaux = creer_ensemble( NULL, NULL, NULL );
+		ajouter_element( initiaux, 0 );
+		Ensemble * finaux = creer_ensemble( NULL, NULL, NULL );
+		ajouter_element( finaux, 1000 );
+		Automate * construit = creer_automate_a_partir_de(
+			etats, NULL, initiaux, finaux, transitions, NB_TRANSITIONS
+		);
+		unsigned long allocations_construit =
+			nombre_d_allocations() - allocations;
+		unsigned long liberations_construit =
+			nombre_de_liberations() - liberations;
+
+		allocations = nombre_d_allocations();
+		liberations = nombre_de_liberations();
+		Automate * automate = creer_automate();
+		ajouter_etat( automate, 500 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 1000 );
+		for( i=0; i<NB_TRANSITIONS; i++ ){
+			ajouter_transition(
+				automate, transitions[i].origine, transitions[i].lettre,
+				transitions[i].fin
+			);
+		}
+		unsigned long allocations_automate =
+			nombre_d_allocations() - allocations;
+		unsigned long liberations_automate =
+			nombre_de_liberations() - liberations;
+
+		int identiques = memes_transitions( construit, automate );
+		TEST(
+			1
+			&& allocations_construit < allocations_automate
+			&& allocations_construit - liberations_construit
+				== allocations_automate - liberations_automate
+			&& identiques
+			&& taille_ensemble( get_etats( construit ) )
+				== taille_ensemble( get_etats( automate ) )
+			&& taille_ensemble( get_alphabet( construit ) ) == 5
+			&& est_un_etat_de_l_automate( construit, 500 )
+			&& est_un_etat_final_de_l_automate( construit, 1000 )
+			&& get_min_etat( construit ) == 0
+			&& get_max_etat( construit ) == 1000
+			&& indice_de_l_etat( construit, 1000 )
+				== taille_ensemble( get_etats( construit ) ) - 1
+			&& est_une_transition_de_l_automate( construit, 7, 'b', 13 )
+			, result
+		);
+
+		liberer_automate( automate );
+		liberer_automate( construit );
+		TEST( allocations_vivantes() == vivantes, result );
+	}
+
+	{
+		// Le miroir, l'automate accessible et l'union ne fuient pas.
+		Automate * automate = creer_automate_a_partir_de(
+			NULL, NULL, NULL, NULL, transitions, NB_TRANSITIONS
+		);
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 13 );
+		Automate * autre = mot_to_automate( "ab" );
+
+		long vivantes = allocations_vivantes();
+		Automate * mir = miroir( automate );
+		liberer_automate( mir );
+		TEST( allocations_vivantes() == vivantes, result );
+
+		Automate * accessible = automate_accessible( automate );
+		liberer_automate( accessible );
+		TEST( allocations_vivantes() == vivantes, result );
+
+		Automate * uni = creer_union_des_automates( automate, autre );
+		liberer_automate( uni );
+		TEST( allocations_vivantes() == vivantes, result );
+
+		liberer_automate( autre );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_allocations() ){ return 1; }
+
+	return 0;
+}
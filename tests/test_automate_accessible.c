@@ -59,6 +59,44 @@ int test_automate_accessible(){
 		liberer_automate( automate );
 	}
 
+	{
+		// Le puits implicite conservé reste implicite, sauf si une
+		// transition supprimée doit le rester.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'a', 1 );
+		ajouter_transition( automate, 1, 'b', 1 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 1 );
+		Automate * complement = complementer( automate );
+		ajouter_etat( complement, 100 );
+		int puits = get_etat_puits( complement );
+		Automate * aut = automate_accessible( complement );
+
+		Automate * perdu = copier_automate( complement );
+		ajouter_transition( perdu, puits, 'b', 100 );
+		Automate * aut_perdu = automate_accessible( perdu );
+		Ensemble * fins = delta1( aut_perdu, puits, 'b' );
+
+		TEST(
+			1
+			&& a_un_etat_puits( aut )
+			&& get_etat_puits( aut ) == puits
+			&& ! est_un_etat_de_l_automate( aut, 100 )
+			&& est_une_transition_de_l_automate( aut, puits, 'b', puits )
+			&& ! a_un_etat_puits( aut_perdu )
+			&& taille_ensemble( fins ) == 0
+			&& est_une_transition_de_l_automate( aut_perdu, puits, 'a', puits )
+			, result
+		);
+		liberer_ensemble( fins );
+		liberer_automate( aut_perdu );
+		liberer_automate( perdu );
+		liberer_automate( aut );
+		liberer_automate( complement );
+		liberer_automate( automate );
+	}
+
 	return result;
 }
 
@@ -0,0 +1,144 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "motifs.h"
+#include "outils.h"
+
+#include <string.h>
+
+void action_compter_motifs( int motif, int fin, void* data ){
+	int * fins = (int*) data;
+	fins[ fins[0] + 1 ] = fin;
+	fins[0]++;
+}
+
+int test_binaire(){
+
+	int result = 1;
+
+	{
+		// Le mot "a\0\xc8" puis des octets 0xff, sur un alphabet contenant
+		// des octets au-delà de 127.
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 1 );
+		ajouter_transition( aut, 1, '\0', 2 );
+		ajouter_transition( aut, 2, (char) 200, 3 );
+		ajouter_transition( aut, 3, (char) 255, 3 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 3 );
+
+		const char mot[] = { 'a', '\0', (char) 200, (char) 255, (char) 255 };
+		const char mauvais[] = { 'a', '\0', (char) 200, (char) 254 };
+
+		// Les lettres sont rangées comme des octets non signés.
+		Ensemble_iterateur it = premier_iterateur_ensemble( get_alphabet( aut ) );
+		int ordre = get_element( it ) == 0;
+		it = iterateur_suivant_ensemble( it );
+		ordre = ordre && get_element( it ) == 'a';
+		it = iterateur_suivant_ensemble( it );
+		ordre = ordre && get_element( it ) == 200;
+		it = iterateur_suivant_ensemble( it );
+		ordre = ordre && get_element( it ) == 255;
+
+		TEST(
+			1
+			&& ordre
+			&& est_une_lettre_de_l_automate( aut, '\0' )
+			&& est_une_lettre_de_l_automate( aut, (char) 200 )
+			&& est_une_lettre_de_l_automate( aut, (char) 255 )
+			&& ! est_une_lettre_de_l_automate( aut, (char) 254 )
+			&& ! est_une_lettre_de_l_automate( aut, 'b' )
+			&& est_une_transition_de_l_automate( aut, 2, (char) 200, 3 )
+			&& le_mot_binaire_est_reconnu( aut, mot, 3 )
+			&& le_mot_binaire_est_reconnu( aut, mot, 5 )
+			&& ! le_mot_binaire_est_reconnu( aut, mot, 2 )
+			&& ! le_mot_binaire_est_reconnu( aut, mauvais, 4 )
+			// Le mot texte "a" s'arrête au caractère nul.
+			&& ! le_mot_est_reconnu( aut, mot )
+			, result
+		);
+
+		Automate_dense * dense = compiler_automate( aut );
+		TEST(
+			1
+			&& le_mot_binaire_est_reconnu_dense( dense, mot, 3 )
+			&& le_mot_binaire_est_reconnu_dense( dense, mot, 5 )
+			&& ! le_mot_binaire_est_reconnu_dense( dense, mot, 2 )
+			&& ! le_mot_binaire_est_reconnu_dense( dense, mauvais, 4 )
+			, result
+		);
+		liberer_automate_dense( dense );
+
+		// Les lettres au-delà de 127 viennent après les autres.
+		ajouter_transition( aut, 0, 'b', 3 );
+		Enumerateur * enumerateur = creer_enumerateur( aut );
+		const char * premier = mot_suivant( enumerateur );
+		int premier_ok = premier && strcmp( premier, "b" ) == 0;
+		const char * deuxieme = mot_suivant( enumerateur );
+		int deuxieme_ok = deuxieme
+			&& (unsigned char) deuxieme[0] == 'b'
+			&& (unsigned char) deuxieme[1] == 255;
+		TEST( premier_ok && deuxieme_ok, result );
+		liberer_enumerateur( enumerateur );
+
+		liberer_automate( aut );
+	}
+
+	{
+		// Recherche de motifs dans un texte contenant des octets nuls.
+		const Automate * automates[1];
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, '\0', 1 );
+		ajouter_transition( aut, 1, (char) 0x80, 2 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 2 );
+		automates[0] = aut;
+		Motifs * motifs = compiler_motifs( automates, 1 );
+
+		const char texte[] = { 'x', '\0', (char) 0x80, '\0', '\0', (char) 0x80 };
+		int fins[8];
+		fins[0] = 0;
+		chercher_motifs_binaire( motifs, texte, 6, action_compter_motifs, fins );
+		TEST(
+			1
+			&& fins[0] == 2
+			&& fins[1] == 3
+			&& fins[2] == 6
+			, result
+		);
+
+		liberer_motifs( motifs );
+		liberer_automate( aut );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_binaire() ){ return 1; }
+
+	return 0;
+}
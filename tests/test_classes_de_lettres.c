@@ -0,0 +1,164 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "outils.h"
+
+#include <string.h>
+
+int test_classes_de_lettres(){
+
+	int result = 1;
+
+	{
+		// Les mots sur {a, ..., z} contenant un 'z'.
+		Automate * aut = creer_automate();
+		char lettre;
+		for( lettre = 'a'; lettre <= 'z'; lettre++ ){
+			if( lettre != 'z' ) ajouter_transition( aut, 0, lettre, 0 );
+			ajouter_transition( aut, 1, lettre, 1 );
+		}
+		ajouter_transition( aut, 0, 'z', 1 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 1 );
+
+		int classes[NB_LETTRES];
+		int nb_classes = classes_de_lettres( aut, classes );
+		TEST(
+			1
+			&& nb_classes == 2
+			&& classes['a'] == 0
+			&& classes['m'] == 0
+			&& classes['y'] == 0
+			&& classes['z'] == 1
+			&& classes['A'] == -1
+			&& classes[0] == -1
+			&& classes[255] == -1
+			, result
+		);
+
+		// La table compilée n'a que deux colonnes.
+		Automate_dense * dense = compiler_automate( aut );
+		uint64_t attendu = 1, sans_z = 1;
+		int i;
+		for( i=0; i<40; i++ ){
+			attendu *= 26;
+			sans_z *= 25;
+		}
+		TEST(
+			1
+			&& dense->nb_colonnes == 2
+			&& dense->nb_lettres == 26
+			&& le_mot_est_reconnu_dense( dense, "abzc" )
+			&& ! le_mot_est_reconnu_dense( dense, "abc" )
+			&& ! le_mot_est_reconnu_dense( dense, "Z" )
+			&& nombre_de_mots_de_longueur_dense( dense, 3 ) == 26*26*26 - 25*25*25
+			&& nombre_de_mots_de_longueur_dense( dense, 40 ) == attendu - sans_z
+			, result
+		);
+		liberer_automate_dense( dense );
+
+		// Le tirage choisit aussi la lettre dans sa classe.
+		Generateur * generateur = creer_generateur( aut, 1 );
+		char mot[2];
+		uint64_t graine = 7;
+		int vus[NB_LETTRES];
+		for( i=0; i<NB_LETTRES; i++ ) vus[i] = 0;
+		for( i=0; i<1000; i++ ){
+			generer_mot( generateur, 1, mot, &graine );
+			vus[ (unsigned char) mot[0] ]++;
+		}
+		TEST( vus['z'] == 1000, result );
+		liberer_generateur( generateur );
+
+		generateur = creer_generateur( aut, 2 );
+		int nb_vues = 0;
+		for( i=0; i<NB_LETTRES; i++ ) vus[i] = 0;
+		for( i=0; i<5000; i++ ){
+			char mot_2[3];
+			generer_mot( generateur, 2, mot_2, &graine );
+			if( mot_2[1] == 'z' ) vus[ (unsigned char) mot_2[0] ]++;
+		}
+		for( i=0; i<NB_LETTRES; i++ ) nb_vues += vus[i] > 0;
+		TEST( nb_vues == 26, result );
+		liberer_generateur( generateur );
+
+		liberer_automate( aut );
+	}
+
+	{
+		// Non déterministe : 'a' et 'b' ne sont séparées que par l'état 1,
+		// 'c' et 'd' ne le sont jamais.
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 1 );
+		ajouter_transition( aut, 0, 'a', 2 );
+		ajouter_transition( aut, 0, 'b', 2 );
+		ajouter_transition( aut, 0, 'b', 1 );
+		ajouter_transition( aut, 1, 'a', 0 );
+		ajouter_transition( aut, 1, 'c', 2 );
+		ajouter_transition( aut, 1, 'd', 2 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 2 );
+
+		int classes[NB_LETTRES];
+		TEST(
+			1
+			&& classes_de_lettres( aut, classes ) == 3
+			&& classes['a'] == 0
+			&& classes['b'] == 1
+			&& classes['c'] == 2
+			&& classes['d'] == 2
+			, result
+		);
+		liberer_automate( aut );
+	}
+
+	{
+		Automate * vide = creer_automate();
+		Automate * sans_transition = creer_automate();
+		ajouter_lettre( sans_transition, 'x' );
+		ajouter_lettre( sans_transition, 'y' );
+		int classes[NB_LETTRES];
+		TEST(
+			1
+			&& classes_de_lettres( vide, classes ) == 0
+			&& classes['x'] == -1
+			&& classes_de_lettres( sans_transition, classes ) == 1
+			&& classes['x'] == 0
+			&& classes['y'] == 0
+			, result
+		);
+		liberer_automate( vide );
+		liberer_automate( sans_transition );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_classes_de_lettres() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "outils.h"
+
+int test_co_accessibles(){
+
+	int result = 1;
+
+	{
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 1 );
+		ajouter_transition( aut, 0, 'b', 2 );
+		ajouter_transition( aut, 2, 'a', 2 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 1 );
+
+		// Sans préparation, la lecture d'un mot ne remplit pas le cache.
+		TEST(
+			1
+			&& le_mot_est_reconnu( aut, "a" )
+			&& ! le_mot_est_reconnu( aut, "baaaaaaa" )
+			&& ! aut->co_accessibles
+			, result
+		);
+
+		const Ensemble * co = etats_co_accessibles( aut );
+		// Ajouter un état ou une transition déjà présents ne change rien.
+		ajouter_etat( aut, 2 );
+		ajouter_transition( aut, 0, 'a', 1 );
+		ajouter_etat_final( aut, 1 );
+		TEST(
+			1
+			&& taille_ensemble( co ) == 2
+			&& est_dans_l_ensemble( co, 0 )
+			&& est_dans_l_ensemble( co, 1 )
+			&& ! est_dans_l_ensemble( co, 2 )
+			&& etats_co_accessibles( aut ) == co
+			&& le_mot_est_reconnu( aut, "a" )
+			&& ! le_mot_est_reconnu( aut, "baaaaaaa" )
+			&& ! le_mot_est_reconnu( aut, "ab" )
+			, result
+		);
+
+		// Le cache est oublié quand l'automate est modifié.
+		ajouter_transition( aut, 2, 'b', 1 );
+		co = etats_co_accessibles( aut );
+		TEST(
+			1
+			&& taille_ensemble( co ) == 3
+			&& est_dans_l_ensemble( co, 2 )
+			&& le_mot_est_reconnu( aut, "baaab" )
+			, result
+		);
+
+		ajouter_etat_final( aut, 3 );
+		TEST(
+			1
+			&& taille_ensemble( etats_co_accessibles( aut ) ) == 4
+			, result
+		);
+
+		liberer_automate( aut );
+	}
+
+	{
+		// Le puits implicite du complémentaire est final : tous les états sont
+		// co-accessibles. Dans le double complémentaire, l'état atteint par
+		// "b" ne l'est pas.
+		Automate * aut = mot_to_automate( "ab" );
+		Automate * comp = complementer( aut );
+		Automate * comp_comp = complementer( comp );
+		Ensemble * mort = delta_star( comp_comp, get_initiaux( comp_comp ), "b" );
+
+		TEST(
+			1
+			&& taille_ensemble( etats_co_accessibles( comp ) )
+				== taille_ensemble( get_etats( comp ) )
+			&& taille_ensemble( mort ) == 1
+			&& ! est_dans_l_ensemble(
+				etats_co_accessibles( comp_comp ),
+				get_element( premier_iterateur_ensemble( mort ) )
+			)
+			&& le_mot_est_reconnu( comp, "b" )
+			&& le_mot_est_reconnu( comp, "abab" )
+			&& ! le_mot_est_reconnu( comp, "ab" )
+			&& le_mot_est_reconnu( comp_comp, "ab" )
+			&& ! le_mot_est_reconnu( comp_comp, "bab" )
+			, result
+		);
+
+		liberer_ensemble( mort );
+		liberer_automate( aut );
+		liberer_automate( comp );
+		liberer_automate( comp_comp );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_co_accessibles() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,241 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "outils.h"
+
+#include <string.h>
+
+void action_est_deterministe( int origine, char lettre, int fin, void* data ){
+	const Automate * automate = ((const Automate**) data)[0];
+	int * res = ((int**) data)[1];
+	Ensemble * fins = delta1( automate, origine, lettre );
+	if( taille_ensemble( fins ) > 1 ) *res = 0;
+	liberer_ensemble( fins );
+}
+
+int est_deterministe( const Automate * automate ){
+	int res = taille_ensemble( get_initiaux( automate ) ) <= 1;
+	void * data[2];
+	data[0] = (void*) automate;
+	data[1] = &res;
+	pour_toute_transition( automate, action_est_deterministe, data );
+	return res;
+}
+
+/*
+ * Vérifie sur tous les mots de longueur au plus 'n' sur 'lettres' que
+ * 'automate' reconnaît 'mot' si et seulement si 'predicat' est vrai.
+ */
+int verifier_tous_les_mots(
+	const Automate * automate, const char * lettres, int n,
+	int (*predicat)( const char * mot, void * data ), void * data
+){
+	char mot[16];
+	int k = strlen( lettres );
+	int longueur, i;
+	for( longueur=0; longueur<=n; longueur++ ){
+		int compteur[16] = { 0 };
+		while( 1 ){
+			for( i=0; i<longueur; i++ ) mot[i] = lettres[ compteur[i] ];
+			mot[longueur] = '\0';
+			if( le_mot_est_reconnu( automate, mot ) != ( predicat( mot, data ) != 0 ) ){
+				return 0;
+			}
+			for( i=0; i<longueur && ++compteur[i] == k; i++ ) compteur[i] = 0;
+			if( i == longueur ) break;
+		}
+	}
+	return 1;
+}
+
+int predicat_determinise( const char * mot, void * data ){
+	return le_mot_est_reconnu( (const Automate*) data, mot );
+}
+
+int predicat_complementaire( const char * mot, void * data ){
+	return ! le_mot_est_reconnu( (const Automate*) data, mot );
+}
+
+int predicat_difference( const char * mot, void * data ){
+	const Automate ** automates = (const Automate **) data;
+	return le_mot_est_reconnu( automates[0], mot )
+		&& ! le_mot_est_reconnu( automates[1], mot );
+}
+
+int test_complementer(){
+
+	int result = 1;
+
+	// Mots dont l'avant-dernière lettre est un 'a'.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 2 );
+
+	{
+		Automate * det = determiniser( automate );
+
+		TEST(
+			1
+			&& det
+			&& est_deterministe( det )
+			&& est_un_etat_initial_de_l_automate( det, 0 )
+			&& taille_ensemble( get_etats( det ) ) == 4
+			&& verifier_tous_les_mots( det, "ab", 6, predicat_determinise, automate )
+			, result
+		);
+
+		liberer_automate( det );
+	}
+
+	{
+		Automate * comp = complementer( automate );
+
+		TEST(
+			1
+			&& comp
+			&& a_un_etat_puits( comp )
+			&& est_un_etat_final_de_l_automate( comp, get_etat_puits( comp ) )
+			&& verifier_tous_les_mots( comp, "ab", 6, predicat_complementaire, automate )
+			// Les mots contenant une lettre hors de l'alphabet ne sont pas
+			// reconnus par le complémentaire.
+			&& ! le_mot_est_reconnu( comp, "c" )
+			, result
+		);
+
+		liberer_automate( comp );
+	}
+
+	{
+		// Complémentaire d'un automate partiel : "ab" seulement.
+		Automate * mot = mot_to_automate( "ab" );
+		Automate * det = determiniser( mot );
+		Automate * comp = complementer( mot );
+		Automate * comp2 = complementer( comp );
+
+		TEST(
+			1
+			&& comp
+			// Aucune transition vers le puits n'est stockée.
+			&& taille_table( comp->transitions ) == taille_table( det->transitions )
+			&& est_une_transition_de_l_automate(
+				comp, 0, 'b', get_etat_puits( comp )
+			)
+			&& est_une_transition_de_l_automate(
+				comp, get_etat_puits( comp ), 'a', get_etat_puits( comp )
+			)
+			&& verifier_tous_les_mots( comp, "ab", 5, predicat_complementaire, mot )
+			&& verifier_tous_les_mots( comp2, "ab", 5, predicat_determinise, mot )
+			, result
+		);
+
+		liberer_automate( comp2 );
+		liberer_automate( comp );
+		liberer_automate( det );
+		liberer_automate( mot );
+	}
+
+	{
+		// Complémentaire de l'automate vide : tous les mots.
+		Automate * vide = creer_automate();
+		ajouter_lettre( vide, 'a' );
+		Automate * comp = complementer( vide );
+
+		TEST(
+			1
+			&& le_mot_est_reconnu( comp, "" )
+			&& le_mot_est_reconnu( comp, "aaa" )
+			, result
+		);
+
+		liberer_automate( comp );
+		liberer_automate( vide );
+	}
+
+	{
+		// Mots reconnus par 'automate' ne se terminant pas par 'bc', sur un
+		// alphabet plus grand que celui de 'automate'.
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 0 );
+		ajouter_transition( aut, 0, 'b', 0 );
+		ajouter_transition( aut, 0, 'c', 0 );
+		ajouter_transition( aut, 0, 'b', 1 );
+		ajouter_transition( aut, 1, 'c', 2 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 2 );
+
+		Automate * union_aut = creer_union_des_automates( automate, aut );
+		Automate * diff = difference( union_aut, aut );
+		const Automate * automates[2];
+		automates[0] = union_aut;
+		automates[1] = aut;
+
+		TEST(
+			1
+			&& diff
+			&& le_mot_est_reconnu( diff, "ab" )
+			&& ! le_mot_est_reconnu( diff, "abc" )
+			&& verifier_tous_les_mots( diff, "abc", 5, predicat_difference, automates )
+			, result
+		);
+
+		// Le complémentaire reste correct une fois recopié par une union :
+		// ses transitions implicites y sont matérialisées.
+		Automate * comp = complementer( aut );
+		Automate * uni = creer_union_des_automates( comp, automate );
+		Automate * copie = copier_automate( comp );
+
+		TEST(
+			1
+			&& le_mot_est_reconnu( uni, "cab" )
+			&& le_mot_est_reconnu( uni, "ab" )
+			&& ! le_mot_est_reconnu( uni, "bc" )
+			&& a_un_etat_puits( copie )
+			&& le_mot_est_reconnu( copie, "cab" )
+			&& ! le_mot_est_reconnu( copie, "abc" )
+			, result
+		);
+
+		liberer_automate( copie );
+		liberer_automate( uni );
+		liberer_automate( comp );
+		liberer_automate( diff );
+		liberer_automate( union_aut );
+		liberer_automate( aut );
+	}
+
+	liberer_automate( automate );
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_complementer() ){ return 1; }
+
+	return 0;
+}
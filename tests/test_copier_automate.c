@@ -0,0 +1,224 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "outils.h"
+
+int test_copier_automate(){
+
+	int result = 1;
+
+	{
+		// La copie partage tout, puis ne duplique que ce qui est modifié.
+		Automate * automate = mot_to_automate( "abc" );
+		Automate * copie = copier_automate( automate );
+		TEST(
+			1
+			&& get_etats( copie ) == get_etats( automate )
+			&& get_finaux( copie ) == get_finaux( automate )
+			&& le_mot_est_reconnu( copie, "abc" )
+			&& indice_de_l_etat( copie, 3 ) == indice_de_l_etat( automate, 3 )
+			, result
+		);
+
+		ajouter_etat_final( copie, 1 );
+		TEST(
+			1
+			&& get_finaux( copie ) != get_finaux( automate )
+			&& get_etats( copie ) == get_etats( automate )
+			&& get_initiaux( copie ) == get_initiaux( automate )
+			&& le_mot_est_reconnu( copie, "a" )
+			&& ! le_mot_est_reconnu( automate, "a" )
+			, result
+		);
+
+		// Ajouter ce qui existe déjà ne duplique rien.
+		ajouter_transition( copie, 0, 'a', 1 );
+		ajouter_etat_initial( copie, 0 );
+		TEST(
+			1
+			&& get_etats( copie ) == get_etats( automate )
+			&& get_alphabet( copie ) == get_alphabet( automate )
+			&& get_initiaux( copie ) == get_initiaux( automate )
+			, result
+		);
+
+		// L'automate d'origine peut lui aussi être modifié.
+		ajouter_transition( automate, 3, 'd', 4 );
+		ajouter_etat_final( automate, 4 );
+		TEST(
+			1
+			&& le_mot_est_reconnu( automate, "abcd" )
+			&& ! le_mot_est_reconnu( copie, "abcd" )
+			&& ! est_un_etat_de_l_automate( copie, 4 )
+			&& ! est_une_lettre_de_l_automate( copie, 'd' )
+			&& get_max_etat( copie ) == 3
+			&& get_max_etat( automate ) == 4
+			&& indice_de_l_etat( automate, 4 ) == 4
+			, result
+		);
+
+		liberer_automate( automate );
+		TEST( le_mot_est_reconnu( copie, "abc" ), result );
+		liberer_automate( copie );
+	}
+
+	{
+		// Des copies de copies, libérées dans le désordre, sans fuite.
+		long vivantes = (long) nombre_d_allocations()
+			- (long) nombre_de_liberations();
+		Automate * automate = mot_to_automate( "ab" );
+		Automate * copie1 = copier_automate( automate );
+		Automate * copie2 = copier_automate( copie1 );
+
+		unsigned long allocations = nombre_d_allocations();
+		Automate * copie3 = copier_automate( copie2 );
+		unsigned long allocations_copie = nombre_d_allocations() - allocations;
+
+		// Le coût d'une copie ne dépend pas de la taille de l'automate.
+		char mot[1001];
+		int i;
+		for( i=0; i<1000; i++ ) mot[i] = 'a' + i % 26;
+		mot[1000] = '\0';
+		Automate * grand = mot_to_automate( mot );
+		Automate * grande_copie = copier_automate( grand );
+		liberer_automate( grand );
+		allocations = nombre_d_allocations();
+		Automate * grande_copie2 = copier_automate( grande_copie );
+		unsigned long allocations_grande_copie =
+			nombre_d_allocations() - allocations;
+		liberer_automate( grande_copie );
+		liberer_automate( grande_copie2 );
+
+		retirer_etat( copie1, 2 );
+		Transition transitions[] = { { 2, 'c', 5 }, { 5, 'c', 2 } };
+		ajouter_transitions( copie2, transitions, 2 );
+		Automate * uni = creer_union_des_automates( copie3, automate );
+
+		TEST(
+			1
+			&& allocations_copie == allocations_grande_copie
+			&& le_mot_est_reconnu( automate, "ab" )
+			&& ! le_mot_est_reconnu( copie1, "ab" )
+			&& le_mot_est_reconnu( copie2, "abcc" )
+			&& ! le_mot_est_reconnu( automate, "abcc" )
+			&& le_mot_est_reconnu( copie3, "ab" )
+			&& taille_ensemble( get_etats( copie1 ) ) == 2
+			&& taille_ensemble( get_etats( copie3 ) ) == 3
+			&& taille_ensemble( get_etats( uni ) ) == 6
+			, result
+		);
+
+		liberer_automate( copie2 );
+		liberer_automate( automate );
+		liberer_automate( uni );
+		liberer_automate( copie3 );
+		liberer_automate( copie1 );
+		TEST(
+			(long) nombre_d_allocations() - (long) nombre_de_liberations()
+			== vivantes
+			, result
+		);
+	}
+
+	{
+		// Une chaîne de versions : chaque version est la copie de la
+		// précédente plus une transition. Le coût d'une version ne dépend
+		// pas du nombre de transitions déjà présentes.
+		long vivantes = (long) nombre_d_allocations()
+			- (long) nombre_de_liberations();
+		Automate * versions[51];
+		versions[0] = creer_automate();
+		int i;
+		for( i=0; i<1000; i++ ){
+			ajouter_transition( versions[0], i, 'a' + i % 3, i+1 );
+		}
+		unsigned long max_allocations = 0;
+		for( i=1; i<=50; i++ ){
+			unsigned long allocations = nombre_d_allocations();
+			versions[i] = copier_automate( versions[i-1] );
+			ajouter_transition( versions[i], 0, 'z', i );
+			unsigned long cout = nombre_d_allocations() - allocations;
+			if( cout > max_allocations ) max_allocations = cout;
+		}
+
+		// On libère les versions intermédiaires : les autres sont intactes.
+		for( i=1; i<50; i++ ){
+			if( i != 25 ) liberer_automate( versions[i] );
+		}
+		Ensemble * fins0 = delta1( versions[0], 0, 'z' );
+		Ensemble * fins25 = delta1( versions[25], 0, 'z' );
+		Ensemble * fins50 = delta1( versions[50], 0, 'z' );
+		TEST(
+			1
+			&& max_allocations < 200
+			&& taille_ensemble( fins0 ) == 0
+			&& taille_ensemble( fins25 ) == 25
+			&& taille_ensemble( fins50 ) == 50
+			&& est_dans_l_ensemble( fins25, 25 )
+			&& ! est_dans_l_ensemble( fins25, 26 )
+			&& est_une_transition_de_l_automate( versions[25], 999, 'a', 1000 )
+			&& est_une_transition_de_l_automate( versions[50], 500, 'c', 501 )
+			, result
+		);
+		liberer_ensemble( fins0 );
+		liberer_ensemble( fins25 );
+		liberer_ensemble( fins50 );
+
+		liberer_automate( versions[0] );
+		liberer_automate( versions[50] );
+		liberer_automate( versions[25] );
+		TEST(
+			(long) nombre_d_allocations() - (long) nombre_de_liberations()
+			== vivantes
+			, result
+		);
+	}
+
+	{
+		// L'état puits implicite est conservé.
+		Automate * aut = mot_to_automate( "a" );
+		Automate * complement = complementer( aut );
+		Automate * copie = copier_automate( complement );
+		liberer_automate( complement );
+		TEST(
+			1
+			&& a_un_etat_puits( copie )
+			&& le_mot_est_reconnu( copie, "" )
+			&& le_mot_est_reconnu( copie, "aa" )
+			&& ! le_mot_est_reconnu( copie, "a" )
+			, result
+		);
+		liberer_automate( copie );
+		liberer_automate( aut );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_copier_automate() ){ return 1; }
+
+	return 0;
+}
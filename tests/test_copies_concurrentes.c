@@ -0,0 +1,149 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "outils.h"
+
+#include <threads.h>
+
+#define NB_ETATS 300
+#define NB_COPIES 200
+
+/*
+ * Un thread copie et relit l'automate source ; deux autres modifient chacun
+ * leurs copies de la source, faites au départ par un seul thread. Toutes ces
+ * copies partagent les composantes, les noeuds des arbres et les ensembles
+ * d'arrivée de la source.
+ */
+typedef struct {
+	const Automate * source;
+	Automate ** copies;
+	int lettre;
+	int resultat;
+} Donnees_thread;
+
+int copier_la_source( void * data ){
+	Donnees_thread * donnees = (Donnees_thread*) data;
+	int i;
+	for( i=0; i<NB_COPIES; i++ ){
+		Automate * copie = copier_automate( donnees->source );
+		if(
+			! le_mot_est_reconnu( copie, "ab" )
+			|| le_mot_est_reconnu( copie, "c" )
+		){
+			donnees->resultat = 0;
+		}
+		liberer_automate( copie );
+	}
+	return 0;
+}
+
+int modifier_les_copies( void * data ){
+	Donnees_thread * donnees = (Donnees_thread*) data;
+	char mot[2] = { donnees->lettre, '\0' };
+	int i;
+	for( i=0; i<NB_COPIES; i++ ){
+		Automate * copie = donnees->copies[i];
+		ajouter_transition( copie, 0, donnees->lettre, 2 );
+		ajouter_transition( copie, i, 'a', NB_ETATS + i );
+		retirer_transition( copie, NB_ETATS / 2, 'a', NB_ETATS / 2 + 1 );
+		retirer_etat( copie, NB_ETATS - 1 );
+		if(
+			! le_mot_est_reconnu( copie, mot )
+			|| ! le_mot_est_reconnu( copie, "ab" )
+			|| ! est_une_transition_de_l_automate( copie, i, 'a', NB_ETATS + i )
+			|| est_une_transition_de_l_automate(
+				copie, NB_ETATS / 2, 'a', NB_ETATS / 2 + 1
+			)
+			|| est_un_etat_de_l_automate( copie, NB_ETATS - 1 )
+		){
+			donnees->resultat = 0;
+		}
+		liberer_automate( copie );
+	}
+	return 0;
+}
+
+int test_copies_concurrentes(){
+	int result = 1;
+
+	long vivantes = (long) nombre_d_allocations()
+		- (long) nombre_de_liberations();
+
+	Automate * source = mot_to_automate( "ab" );
+	int i;
+	for( i=0; i<NB_ETATS; i++ ){
+		ajouter_transition( source, i, 'a' + i % 2, i + 1 );
+		ajouter_transition( source, i, 'b', ( 7 * i ) % NB_ETATS );
+	}
+
+	Automate * copies[2][NB_COPIES];
+	for( i=0; i<NB_COPIES; i++ ){
+		copies[0][i] = copier_automate( source );
+		copies[1][i] = copier_automate( source );
+	}
+
+	Donnees_thread copieur = { source, NULL, 0, 1 };
+	Donnees_thread modificateurs[2] = {
+		{ source, copies[0], 'c', 1 },
+		{ source, copies[1], 'd', 1 }
+	};
+	thrd_t threads[3];
+	thrd_create( &threads[0], copier_la_source, &copieur );
+	thrd_create( &threads[1], modifier_les_copies, &modificateurs[0] );
+	thrd_create( &threads[2], modifier_les_copies, &modificateurs[1] );
+	for( i=0; i<3; i++ ){
+		thrd_join( threads[i], NULL );
+	}
+
+	TEST(
+		1
+		&& copieur.resultat
+		&& modificateurs[0].resultat
+		&& modificateurs[1].resultat
+		&& taille_ensemble( get_etats( source ) ) == NB_ETATS + 1
+		&& est_une_transition_de_l_automate(
+			source, NB_ETATS / 2, 'a', NB_ETATS / 2 + 1
+		)
+		&& ! est_une_transition_de_l_automate( source, 0, 'a', NB_ETATS )
+		&& ! le_mot_est_reconnu( source, "c" )
+		&& ! le_mot_est_reconnu( source, "d" )
+		, result
+	);
+
+	liberer_automate( source );
+	TEST(
+		(long) nombre_d_allocations() - (long) nombre_de_liberations()
+		== vivantes
+		, result
+	);
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_copies_concurrentes() ){ return 1; }
+
+	return 0;
+}
@@ -537,6 +537,54 @@ int test_comparer_ensemble(){
 	return result;
 }
 
+int test_empreinte_ensemble(){
+	int result = 1;
+
+	Ensemble * ens1 = creer_ensemble( NULL, NULL, NULL );
+	Ensemble * ens2 = creer_ensemble( NULL, NULL, NULL );
+	uint64_t vide = empreinte_ensemble( ens1 );
+	int i;
+	for( i=0; i<20; i++ ){
+		ajouter_element( ens1, i );
+		ajouter_element( ens2, 19 - i );
+	}
+	// Un doublon ne change pas l'empreinte.
+	ajouter_element( ens1, 3 );
+	TEST(
+		1
+		&& empreinte_ensemble( ens1 ) == empreinte_ensemble( ens2 )
+		&& empreinte_ensemble( ens1 ) != vide
+		, result
+	);
+
+	retirer_element( ens1, 7 );
+	retirer_element( ens1, 7 );
+	Ensemble * copie = copier_ensemble( ens1 );
+	TEST(
+		1
+		&& empreinte_ensemble( ens1 ) != empreinte_ensemble( ens2 )
+		&& empreinte_ensemble( copie ) == empreinte_ensemble( ens1 )
+		, result
+	);
+
+	ajouter_element( ens1, 7 );
+	swap_ensemble( copie, ens2 );
+	TEST(
+		1
+		&& empreinte_ensemble( ens1 ) == empreinte_ensemble( copie )
+		&& empreinte_ensemble( ens2 ) != empreinte_ensemble( copie )
+		, result
+	);
+
+	vider_ensemble( ens1 );
+	TEST( empreinte_ensemble( ens1 ) == vide, result );
+
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+	liberer_ensemble( copie );
+	return result;
+}
+
 int test_copier_ensemble(){
 	int result = 1;
 
@@ -561,7 +609,24 @@ int test_copier_ensemble(){
 	TEST( ens1 != ens2, result );
 	TEST( comparer_ensemble( ens1, ens2 ) == 0, result );
 
+	// La copie partage les noeuds de l'original : les modifications de l'un
+	// ne sont pas visibles dans l'autre.
+	ajouter_element( ens2, 7 );
+	retirer_element( ens2, 1 );
+	retirer_element( ens1, 5 );
+	TEST(
+		1
+		&& taille_ensemble( ens1 ) == 2
+		&& est_dans_l_ensemble( ens1, 1 )
+		&& ! est_dans_l_ensemble( ens1, 7 )
+		&& taille_ensemble( ens2 ) == 3
+		&& est_dans_l_ensemble( ens2, 5 )
+		&& ! est_dans_l_ensemble( ens2, 1 )
+		, result
+	);
+
 	liberer_ensemble( ens1 );
+	TEST( est_dans_l_ensemble( ens2, 2 ), result );
 	liberer_ensemble( ens2 );
 
 
@@ -609,6 +674,29 @@ int test_copier_ensemble(){
 	return result;
 }
 
+int test_retenir_ensemble(){
+	int result = 1;
+
+	long vivantes = (long) nombre_d_allocations()
+		- (long) nombre_de_liberations();
+	Ensemble * ens = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( ens, 1 );
+	Ensemble * retenu = retenir_ensemble( ens );
+	TEST( retenu == ens, result );
+
+	// Le premier appel à liberer_ensemble() ne libère rien.
+	liberer_ensemble( ens );
+	TEST( est_dans_l_ensemble( ens, 1 ), result );
+
+	liberer_ensemble( ens );
+	TEST(
+		(long) nombre_d_allocations() - (long) nombre_de_liberations()
+		== vivantes
+		, result
+	);
+	return result;
+}
+
 typedef struct {
 	int min;
 	int max;
@@ -952,7 +1040,9 @@ int main(){
 	result &= test_est_dans_l_ensemble();
 	result &= test_taille_ensemble();
 	result &= test_comparer_ensemble();
+	result &= test_empreinte_ensemble();
 	result &= test_copier_ensemble();
+	result &= test_retenir_ensemble();
 	result &= test_pour_tout_element();
 //	result &= test_print_ensemble();
 	result &= test_swap_ensemble();
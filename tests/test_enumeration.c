@@ -0,0 +1,166 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "outils.h"
+
+#include <string.h>
+
+/*
+ * Vérifie que l'énumérateur renvoie exactement les mots attendus, dans
+ * l'ordre, puis NULL si 'fini' est vrai.
+ */
+int enumere(
+	const Automate * automate, const char ** attendus, int nb, int fini
+){
+	Enumerateur * enumerateur = creer_enumerateur( automate );
+	int ok = 1;
+	int i;
+	for( i=0; ok && i<nb; i++ ){
+		const char * mot = mot_suivant( enumerateur );
+		ok = mot && strcmp( mot, attendus[i] ) == 0;
+	}
+	if( ok && fini ){
+		ok = mot_suivant( enumerateur ) == NULL
+			&& mot_suivant( enumerateur ) == NULL;
+	}
+	liberer_enumerateur( enumerateur );
+	return ok;
+}
+
+int test_enumeration(){
+
+	int result = 1;
+
+	{
+		const Automate * mots[5];
+		mots[0] = mot_to_automate( "aaa" );
+		mots[1] = mot_to_automate( "ba" );
+		mots[2] = mot_to_automate( "b" );
+		mots[3] = mot_to_automate( "ab" );
+		mots[4] = mot_to_automate( "a" );
+		Automate * aut = creer_union_de_n_automates( mots, 5, NULL );
+
+		const char * attendus[] = { "a", "b", "ab", "ba", "aaa" };
+		TEST( enumere( aut, attendus, 5, 1 ), result );
+
+		int i;
+		for( i=0; i<5; i++ ) liberer_automate( (Automate*) mots[i] );
+		liberer_automate( aut );
+	}
+
+	{
+		// (ab)* | c, avec une branche morte sur 'd'.
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 1 );
+		ajouter_transition( aut, 1, 'b', 0 );
+		ajouter_transition( aut, 0, 'c', 2 );
+		ajouter_transition( aut, 0, 'd', 3 );
+		ajouter_transition( aut, 3, 'd', 3 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 0 );
+		ajouter_etat_final( aut, 2 );
+
+		const char * attendus[] = { "", "c", "ab", "abc", "abab", "ababc" };
+		TEST( enumere( aut, attendus, 6, 0 ), result );
+		liberer_automate( aut );
+	}
+
+	{
+		// Le complémentaire de {a, b}* privé de "a" : tous les mots sauf "a".
+		Automate * aut = mot_to_automate( "a" );
+		ajouter_lettre( aut, 'b' );
+		Automate * comp = complementer( aut );
+		Automate * vide = creer_automate();
+
+		const char * attendus[] = { "", "b", "aa", "ab", "ba", "bb", "aaa" };
+		TEST( enumere( comp, attendus, 7, 0 ), result );
+		TEST( enumere( vide, attendus, 0, 1 ), result );
+
+		liberer_automate( aut );
+		liberer_automate( comp );
+		liberer_automate( vide );
+	}
+
+	{
+		// (a|b)^n c : le plus court mot est long, et il y a 2^n mots de
+		// cette longueur ; seuls les premiers sont demandés.
+		enum { N = 1000 };
+		Automate * aut = creer_automate();
+		int i;
+		for( i=0; i<N; i++ ){
+			ajouter_transition( aut, i, 'a', i+1 );
+			ajouter_transition( aut, i, 'b', i+1 );
+		}
+		ajouter_transition( aut, N, 'c', N+1 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, N+1 );
+
+		static char attendus[3][N+2];
+		for( i=0; i<N; i++ ){
+			attendus[0][i] = 'a';
+			attendus[1][i] = 'a';
+			attendus[2][i] = 'a';
+		}
+		attendus[1][N-1] = 'b';
+		attendus[2][N-2] = 'b';
+		for( i=0; i<3; i++ ){
+			attendus[i][N] = 'c';
+			attendus[i][N+1] = '\0';
+		}
+		const char * mots[3] = { attendus[0], attendus[1], attendus[2] };
+		TEST( enumere( aut, mots, 3, 0 ), result );
+		liberer_automate( aut );
+	}
+
+	{
+		// (aaa)* : les longueurs qui ne sont pas multiples de 3 sont sautées.
+		// Le langage de 'ab' est fini : l'énumération s'arrête, bien que ses
+		// deux mots soient séparés par des longueurs sans mot.
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 1 );
+		ajouter_transition( aut, 1, 'a', 2 );
+		ajouter_transition( aut, 2, 'a', 0 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 0 );
+		Automate * ab = mot_to_automate( "aaaaaaab" );
+		ajouter_etat_final( ab, 0 );
+
+		const char * attendus[] = { "", "aaa", "aaaaaa", "aaaaaaaaa" };
+		const char * attendus_ab[] = { "", "aaaaaaab" };
+		TEST( enumere( aut, attendus, 4, 0 ), result );
+		TEST( enumere( ab, attendus_ab, 2, 1 ), result );
+		liberer_automate( aut );
+		liberer_automate( ab );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_enumeration() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "outils.h"
+
+#include <string.h>
+
+int test_equivalence(){
+
+	int result = 1;
+
+	{
+		// (ab)* reconnu de deux façons différentes.
+		Automate * aut1 = creer_automate();
+		ajouter_transition( aut1, 0, 'a', 1 );
+		ajouter_transition( aut1, 1, 'b', 0 );
+		ajouter_etat_initial( aut1, 0 );
+		ajouter_etat_final( aut1, 0 );
+
+		Automate * aut2 = creer_automate();
+		ajouter_transition( aut2, 0, 'a', 1 );
+		ajouter_transition( aut2, 1, 'b', 2 );
+		ajouter_transition( aut2, 2, 'a', 1 );
+		ajouter_transition( aut2, 0, 'a', 3 );
+		ajouter_etat_initial( aut2, 0 );
+		ajouter_etat_final( aut2, 0 );
+		ajouter_etat_final( aut2, 2 );
+
+		char * mot_1 = (char*) 1;
+		char * mot_2 = (char*) 1;
+		int equivalents = sont_equivalents( aut1, aut2, &mot_1 );
+		int inclus = est_inclus( aut2, aut1, &mot_2 );
+		TEST(
+			1
+			&& equivalents
+			&& mot_1 == NULL
+			&& sont_equivalents( aut2, aut1, NULL )
+			&& est_inclus( aut1, aut2, NULL )
+			&& inclus
+			&& mot_2 == NULL
+			, result
+		);
+
+		ajouter_etat_final( aut2, 3 );
+		equivalents = sont_equivalents( aut1, aut2, &mot_1 );
+		inclus = est_inclus( aut2, aut1, &mot_2 );
+		TEST(
+			1
+			&& ! equivalents
+			&& mot_1 && strcmp( mot_1, "a" ) == 0
+			&& est_inclus( aut1, aut2, NULL )
+			&& ! inclus
+			&& mot_2 && strcmp( mot_2, "a" ) == 0
+			, result
+		);
+		xfree( mot_1 );
+		xfree( mot_2 );
+
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+	}
+
+	{
+		// Le contre-exemple est un plus court mot de la différence symétrique.
+		Automate * aut1 = mot_to_automate( "abba" );
+		Automate * aut2 = mot_to_automate( "abb" );
+		Automate * vide = creer_automate();
+		Automate * epsilon = mot_to_automate( "" );
+
+		char * mot;
+		int resultat;
+		resultat = sont_equivalents( aut1, aut2, &mot );
+		TEST(
+			1
+			&& ! resultat
+			&& strcmp( mot, "abb" ) == 0
+			, result
+		);
+		xfree( mot );
+
+		resultat = sont_equivalents( aut1, epsilon, &mot );
+		TEST(
+			1
+			&& ! resultat
+			&& strcmp( mot, "" ) == 0
+			, result
+		);
+		xfree( mot );
+
+		resultat = est_inclus( aut1, vide, &mot );
+		TEST(
+			1
+			&& est_inclus( vide, aut1, NULL )
+			&& ! resultat
+			&& strcmp( mot, "abba" ) == 0
+			&& ! sont_equivalents( vide, aut1, NULL )
+			&& sont_equivalents( vide, vide, NULL )
+			, result
+		);
+		xfree( mot );
+
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+		liberer_automate( vide );
+		liberer_automate( epsilon );
+	}
+
+	{
+		// Un automate et son déterminisé, puis le complémentaire du
+		// complémentaire, reconnaissent le même langage.
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 0 );
+		ajouter_transition( aut, 0, 'b', 0 );
+		ajouter_transition( aut, 0, 'a', 1 );
+		ajouter_transition( aut, 1, 'b', 2 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 2 );
+
+		Automate * det = determiniser( aut );
+		Automate * comp = complementer( aut );
+		Automate * comp_comp = complementer( comp );
+
+		char * mot;
+		int resultat;
+		resultat = sont_equivalents( aut, comp, &mot );
+		TEST(
+			1
+			&& sont_equivalents( aut, det, NULL )
+			&& sont_equivalents( aut, comp_comp, NULL )
+			&& ! resultat
+			&& strcmp( mot, "" ) == 0
+			, result
+		);
+		xfree( mot );
+
+		// Les mots finissant par "ab" sont inclus dans ceux finissant par "b".
+		Automate * fin_b = creer_automate();
+		ajouter_transition( fin_b, 0, 'a', 0 );
+		ajouter_transition( fin_b, 0, 'b', 0 );
+		ajouter_transition( fin_b, 0, 'b', 1 );
+		ajouter_etat_initial( fin_b, 0 );
+		ajouter_etat_final( fin_b, 1 );
+
+		resultat = est_inclus( fin_b, aut, &mot );
+		TEST(
+			1
+			&& est_inclus( aut, fin_b, NULL )
+			&& ! resultat
+			&& strcmp( mot, "b" ) == 0
+			, result
+		);
+		xfree( mot );
+
+		liberer_automate( aut );
+		liberer_automate( det );
+		liberer_automate( comp );
+		liberer_automate( comp_comp );
+		liberer_automate( fin_b );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_equivalence() ){ return 1; }
+
+	return 0;
+}
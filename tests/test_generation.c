@@ -0,0 +1,126 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "outils.h"
+
+#include <string.h>
+
+#define NB_TIRAGES 8000
+
+int test_generation(){
+
+	int result = 1;
+
+	{
+		Automate * aut = mot_to_automate( "abc" );
+		Generateur * generateur = creer_generateur( aut, 5 );
+		liberer_automate( aut );
+
+		char mot[6];
+		uint64_t graine = 1;
+		int trouve_3 = generer_mot( generateur, 3, mot, &graine );
+		TEST( trouve_3 && strcmp( mot, "abc" ) == 0, result );
+		TEST(
+			1
+			&& ! generer_mot( generateur, 0, mot, &graine )
+			&& ! generer_mot( generateur, 2, mot, &graine )
+			&& ! generer_mot( generateur, 5, mot, &graine )
+			, result
+		);
+		liberer_generateur( generateur );
+	}
+
+	{
+		// Les 8 mots de longueur 4 sans deux 'b' consécutifs doivent être
+		// tirés à peu près aussi souvent les uns que les autres, bien que
+		// l'automate ne soit pas déterministe.
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 0 );
+		ajouter_transition( aut, 0, 'b', 1 );
+		ajouter_transition( aut, 1, 'a', 0 );
+		ajouter_transition( aut, 0, 'a', 2 );
+		ajouter_transition( aut, 2, 'a', 0 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 0 );
+		ajouter_etat_final( aut, 1 );
+
+		Generateur * generateur = creer_generateur( aut, 1000 );
+
+		int occurrences[16];
+		int i, j;
+		for( i=0; i<16; i++ ) occurrences[i] = 0;
+
+		char mot[1001];
+		uint64_t graine = 42;
+		int tous_reconnus = 1;
+		for( i=0; i<NB_TIRAGES; i++ ){
+			if( ! generer_mot( generateur, 4, mot, &graine ) ){
+				tous_reconnus = 0;
+				break;
+			}
+			tous_reconnus = tous_reconnus && le_mot_est_reconnu( aut, mot );
+			int code = 0;
+			for( j=0; j<4; j++ ){
+				code = 2 * code + ( mot[j] == 'b' );
+			}
+			occurrences[code]++;
+		}
+
+		int nb_differents = 0;
+		int uniforme = 1;
+		for( i=0; i<16; i++ ){
+			if( occurrences[i] == 0 ) continue;
+			nb_differents++;
+			uniforme = uniforme
+				&& occurrences[i] > NB_TIRAGES / 8 * 8 / 10
+				&& occurrences[i] < NB_TIRAGES / 8 * 12 / 10;
+		}
+
+		// Les longueurs importantes ne débordent pas.
+		int long_reconnu = generer_mot( generateur, 1000, mot, &graine )
+			&& strlen( mot ) == 1000 && le_mot_est_reconnu( aut, mot );
+
+		TEST(
+			1
+			&& tous_reconnus
+			&& nb_differents == 8
+			&& uniforme
+			&& long_reconnu
+			, result
+		);
+
+		liberer_generateur( generateur );
+		liberer_automate( aut );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_generation() ){ return 1; }
+
+	return 0;
+}
@@ -22,6 +22,8 @@
 #include "automate.h"
 #include "outils.h"
 
+#include <limits.h>
+
 int test_get_max_etat(){
 	int result = 1;
 
@@ -43,6 +45,102 @@ int test_get_max_etat(){
 		liberer_automate( automate );
 	}
 
+	{
+		Automate * automate = creer_automate();
+
+		TEST(
+			1
+			&& get_max_etat( automate ) == INT_MIN
+			&& get_min_etat( automate ) == INT_MAX
+			&& indice_de_l_etat( automate, 0 ) == -1
+			, result
+		);
+
+		ajouter_transition( automate, 7, 'a', -3 );
+		ajouter_etat( automate, 7 );
+		ajouter_etat_final( automate, 12 );
+
+		TEST(
+			1
+			&& get_max_etat( automate ) == 12
+			&& get_min_etat( automate ) == -3
+			// Les indices suivent l'ordre d'ajout des états.
+			&& indice_de_l_etat( automate, 7 ) == 0
+			&& indice_de_l_etat( automate, -3 ) == 1
+			&& indice_de_l_etat( automate, 12 ) == 2
+			&& indice_de_l_etat( automate, 8 ) == -1
+			&& etat_de_l_indice( automate, 0 ) == 7
+			&& etat_de_l_indice( automate, 1 ) == -3
+			&& etat_de_l_indice( automate, 2 ) == 12
+			, result
+		);
+
+		// Les automates construits par l'union et le miroir indexent aussi
+		// tous leurs états.
+		Automate * autre = mot_to_automate( "ab" );
+		Automate * uni = creer_union_des_automates( automate, autre );
+		Automate * mir = miroir( automate );
+		int i, bijection = 1;
+		int min = INT_MAX, max = INT_MIN;
+		for( i=0; i<taille_ensemble( get_etats( uni ) ); i++ ){
+			int etat = etat_de_l_indice( uni, i );
+			if( indice_de_l_etat( uni, etat ) != i ){
+				bijection = 0;
+			}
+			if( etat < min ) min = etat;
+			if( etat > max ) max = etat;
+		}
+		TEST(
+			1
+			&& bijection
+			&& taille_ensemble( get_etats( uni ) ) == 6
+			&& get_min_etat( uni ) == min
+			&& get_max_etat( uni ) == max
+			&& get_max_etat( mir ) == 12
+			&& get_min_etat( mir ) == -3
+			&& indice_de_l_etat( mir, 12 ) >= 0
+			, result
+		);
+		liberer_automate( mir );
+		liberer_automate( uni );
+		liberer_automate( autre );
+		liberer_automate( automate );
+	}
+
+	{
+		// Des états d'abord épars, puis serrés, ajoutés dans le désordre :
+		// les indices restent les mêmes, qu'ils soient lus dans la table ou
+		// dans le tableau direct.
+		Automate * automate = creer_automate();
+		ajouter_etat( automate, INT_MAX );
+		ajouter_etat( automate, INT_MIN );
+		ajouter_etat( automate, 0 );
+		int i, bijection = 1;
+		for( i=1; i<=2000; i++ ){
+			ajouter_etat( automate, i % 2 ? 1000 + i : 1000 - i );
+		}
+		int n = taille_ensemble( get_etats( automate ) );
+		retirer_etat( automate, INT_MIN );
+		retirer_etat( automate, 998 );
+		for( i=0; i<n-2; i++ ){
+			if( indice_de_l_etat( automate, etat_de_l_indice( automate, i ) ) != i ){
+				bijection = 0;
+			}
+		}
+		TEST(
+			1
+			&& n == 2002
+			&& bijection
+			&& indice_de_l_etat( automate, INT_MAX ) == 0
+			&& indice_de_l_etat( automate, 0 ) == 2
+			&& indice_de_l_etat( automate, INT_MIN ) == -1
+			&& indice_de_l_etat( automate, 998 ) == -1
+			&& indice_de_l_etat( automate, 5000 ) == -1
+			, result
+		);
+		liberer_automate( automate );
+	}
+
 	return result;
 }
 
@@ -0,0 +1,117 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "outils.h"
+
+int reconnu_par_les_deux(
+	const Automate * aut1, const Automate * aut2, const Automate * inter,
+	const char * mot
+){
+	int attendu = le_mot_est_reconnu( aut1, mot ) && le_mot_est_reconnu( aut2, mot );
+	return
+		le_mot_est_reconnu( inter, mot ) == attendu
+		&& le_mot_est_reconnu_par_l_intersection( aut1, aut2, mot ) == attendu;
+}
+
+int test_intersection(){
+
+	int result = 1;
+
+	{
+		// Mots contenant un nombre pair de 'a'.
+		Automate * aut1 = creer_automate();
+		ajouter_transition( aut1, 0, 'a', 1 );
+		ajouter_transition( aut1, 1, 'a', 0 );
+		ajouter_transition( aut1, 0, 'b', 0 );
+		ajouter_transition( aut1, 1, 'b', 1 );
+		ajouter_etat_initial( aut1, 0 );
+		ajouter_etat_final( aut1, 0 );
+
+		// Mots se terminant par 'b' (non déterministe).
+		Automate * aut2 = creer_automate();
+		ajouter_transition( aut2, 5, 'a', 5 );
+		ajouter_transition( aut2, 5, 'b', 5 );
+		ajouter_transition( aut2, 5, 'b', 6 );
+		ajouter_etat_initial( aut2, 5 );
+		ajouter_etat_final( aut2, 6 );
+
+		// Un état inaccessible qui ne doit pas apparaître dans le produit.
+		ajouter_transition( aut2, 7, 'a', 5 );
+
+		Automate * inter = creer_intersection_des_automates( aut1, aut2 );
+
+		TEST(
+			1
+			&& inter
+			&& taille_ensemble( get_etats( inter ) ) == 4
+			&& le_mot_est_reconnu( inter, "b" )
+			&& le_mot_est_reconnu( inter, "aab" )
+			&& le_mot_est_reconnu( inter, "abab" )
+			&& ! le_mot_est_reconnu( inter, "ab" )
+			&& ! le_mot_est_reconnu( inter, "aa" )
+			&& ! le_mot_est_reconnu( inter, "" )
+			&& reconnu_par_les_deux( aut1, aut2, inter, "" )
+			&& reconnu_par_les_deux( aut1, aut2, inter, "b" )
+			&& reconnu_par_les_deux( aut1, aut2, inter, "ab" )
+			&& reconnu_par_les_deux( aut1, aut2, inter, "bab" )
+			&& reconnu_par_les_deux( aut1, aut2, inter, "abba" )
+			&& reconnu_par_les_deux( aut1, aut2, inter, "abbab" )
+			&& reconnu_par_les_deux( aut1, aut2, inter, "abbabc" )
+			, result
+		);
+
+		liberer_automate( inter );
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+	}
+
+	{
+		// Alphabets disjoints : seul le mot vide peut être commun.
+		Automate * aut1 = mot_to_automate( "a" );
+		Automate * aut2 = mot_to_automate( "b" );
+		Automate * inter = creer_intersection_des_automates( aut1, aut2 );
+
+		TEST(
+			1
+			&& inter
+			&& taille_ensemble( get_alphabet( inter ) ) == 0
+			&& taille_ensemble( get_finaux( inter ) ) == 0
+			&& ! le_mot_est_reconnu_par_l_intersection( aut1, aut2, "a" )
+			&& ! le_mot_est_reconnu_par_l_intersection( aut1, aut2, "" )
+			, result
+		);
+
+		liberer_automate( inter );
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_intersection() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "intervalles.h"
+#include "outils.h"
+
+int test_intervalles(){
+
+	int result = 1;
+
+	{
+		// Toute lettre sauf le retour à la ligne, puis un retour à la ligne.
+		Automate_intervalles * aut = creer_automate_intervalles();
+		ajouter_transition_intervalle( aut, 0, '\001', '\n' - 1, 0 );
+		ajouter_transition_intervalle( aut, 0, '\n' + 1, '\377', 0 );
+		ajouter_transition_intervalle( aut, 0, '\n', '\n', 1 );
+		ajouter_etat_initial_intervalles( aut, 0 );
+		ajouter_etat_final_intervalles( aut, 1 );
+
+		TEST(
+			1
+			&& nombre_de_segments( aut, 0 ) == 3
+			&& nombre_de_segments( aut, 1 ) == 0
+			&& est_dans_l_ensemble( voisins_intervalles( aut, 0, 'a' ), 0 )
+			&& est_dans_l_ensemble( voisins_intervalles( aut, 0, '\377' ), 0 )
+			&& est_dans_l_ensemble( voisins_intervalles( aut, 0, '\n' ), 1 )
+			&& taille_ensemble( voisins_intervalles( aut, 0, '\n' ) ) == 1
+			&& taille_ensemble( voisins_intervalles( aut, 0, '\0' ) ) == 0
+			&& taille_ensemble( voisins_intervalles( aut, 1, 'a' ) ) == 0
+			&& le_mot_est_reconnu_intervalles( aut, "abc\n" )
+			&& le_mot_est_reconnu_intervalles( aut, "\n" )
+			&& le_mot_est_reconnu_intervalles( aut, "\xe9t\xe9\n" )
+			&& ! le_mot_est_reconnu_intervalles( aut, "abc" )
+			&& ! le_mot_est_reconnu_intervalles( aut, "a\nb\n" )
+			, result
+		);
+
+		Automate * lettres = intervalles_vers_automate( aut );
+		Automate_intervalles * retour = automate_vers_intervalles( lettres );
+		TEST(
+			1
+			&& taille_ensemble( get_alphabet( lettres ) ) == 255
+			&& le_mot_est_reconnu( lettres, "abc\n" )
+			&& ! le_mot_est_reconnu( lettres, "abc" )
+			&& nombre_de_segments( retour, 0 ) == 3
+			&& le_mot_est_reconnu_intervalles( retour, "abc\n" )
+			, result
+		);
+
+		Automate_dense * dense = compiler_automate_intervalles( aut );
+		TEST(
+			1
+			&& dense->nb_colonnes == 2
+			&& dense->nb_lettres == 255
+			&& dense->colonne[0] == -1
+			&& dense->colonne['a'] == dense->colonne[255]
+			&& dense->colonne['a'] != dense->colonne['\n']
+			&& le_mot_est_reconnu_dense( dense, "xyz\n" )
+			&& ! le_mot_est_reconnu_dense( dense, "xyz" )
+			&& nombre_de_mots_de_longueur_dense( dense, 3 ) == 254 * 254
+			, result
+		);
+
+		liberer_automate_dense( dense );
+		liberer_automate_intervalles( retour );
+		liberer_automate( lettres );
+		liberer_automate_intervalles( aut );
+	}
+
+	{
+		// Les intervalles qui se chevauchent sont découpés.
+		Automate_intervalles * aut = creer_automate_intervalles();
+		ajouter_transition_intervalle( aut, 0, 'c', 'f', 1 );
+		ajouter_transition_intervalle( aut, 0, 'a', 'd', 2 );
+		ajouter_transition_intervalle( aut, 0, 'e', 'z', 3 );
+		ajouter_transition_intervalle( aut, 0, 'z', 'a', 4 );
+
+		const Ensemble * b = voisins_intervalles( aut, 0, 'b' );
+		const Ensemble * c = voisins_intervalles( aut, 0, 'c' );
+		const Ensemble * e = voisins_intervalles( aut, 0, 'e' );
+		const Ensemble * g = voisins_intervalles( aut, 0, 'g' );
+		TEST(
+			1
+			&& nombre_de_segments( aut, 0 ) == 4
+			&& taille_ensemble( b ) == 1 && est_dans_l_ensemble( b, 2 )
+			&& taille_ensemble( c ) == 2 && est_dans_l_ensemble( c, 1 )
+			&& est_dans_l_ensemble( c, 2 )
+			&& taille_ensemble( e ) == 2 && est_dans_l_ensemble( e, 1 )
+			&& est_dans_l_ensemble( e, 3 )
+			&& taille_ensemble( g ) == 1 && est_dans_l_ensemble( g, 3 )
+			&& taille_ensemble( voisins_intervalles( aut, 0, '`' ) ) == 0
+			&& taille_ensemble( voisins_intervalles( aut, 0, '{' ) ) == 0
+			, result
+		);
+
+		ajouter_transition_intervalle( aut, 0, 'a', 'z', 5 );
+		TEST(
+			1
+			&& nombre_de_segments( aut, 0 ) == 4
+			&& est_dans_l_ensemble( voisins_intervalles( aut, 0, 'a' ), 5 )
+			&& est_dans_l_ensemble( voisins_intervalles( aut, 0, 'z' ), 5 )
+			, result
+		);
+		liberer_automate_intervalles( aut );
+	}
+
+	{
+		// Le puits implicite est rendu explicite lors de la conversion.
+		Automate * aut = mot_to_automate( "ab" );
+		Automate * complet = complementer( aut );
+		Automate_intervalles * inter = automate_vers_intervalles( complet );
+		TEST(
+			1
+			&& ! le_mot_est_reconnu_intervalles( inter, "ab" )
+			&& le_mot_est_reconnu_intervalles( inter, "a" )
+			&& le_mot_est_reconnu_intervalles( inter, "abab" )
+			&& le_mot_est_reconnu_intervalles( inter, "" )
+			, result
+		);
+		liberer_automate_intervalles( inter );
+		liberer_automate( complet );
+		liberer_automate( aut );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_intervalles() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "motifs.h"
+#include "outils.h"
+
+#define MAX_TROUVES 64
+
+typedef struct {
+	int nb;
+	int motif[MAX_TROUVES];
+	int fin[MAX_TROUVES];
+} Trouves;
+
+void action_test_motifs( int motif, int fin, void* data ){
+	Trouves * t = (Trouves*) data;
+	if( t->nb < MAX_TROUVES ){
+		t->motif[t->nb] = motif;
+		t->fin[t->nb] = fin;
+	}
+	t->nb++;
+}
+
+int est_trouve( const Trouves * t, int motif, int fin ){
+	int i;
+	for( i=0; i<t->nb && i<MAX_TROUVES; i++ ){
+		if( t->motif[i] == motif && t->fin[i] == fin ) return 1;
+	}
+	return 0;
+}
+
+int test_motifs(){
+
+	int result = 1;
+
+	{
+		const Automate * automates[3];
+		Automate * aut0 = mot_to_automate("ab");
+		Automate * aut1 = mot_to_automate("b");
+
+		// (ab)*c, avec des états négatifs pour vérifier les translations.
+		Automate * aut2 = creer_automate();
+		ajouter_transition( aut2, -3, 'a', -2 );
+		ajouter_transition( aut2, -2, 'b', -3 );
+		ajouter_transition( aut2, -3, 'c', -1 );
+		ajouter_etat_initial( aut2, -3 );
+		ajouter_etat_final( aut2, -1 );
+
+		automates[0] = aut0;
+		automates[1] = aut1;
+		automates[2] = aut2;
+
+		Motifs * motifs = compiler_motifs( automates, 3 );
+
+		Trouves t;
+		t.nb = 0;
+		chercher_motifs( motifs, "xabcabb", action_test_motifs, &t );
+
+		TEST(
+			1
+			&& motifs
+			&& nombre_de_motifs( motifs ) == 3
+			&& t.nb == 6
+			&& est_trouve( &t, 0, 3 )
+			&& est_trouve( &t, 1, 3 )
+			&& est_trouve( &t, 2, 4 )
+			&& est_trouve( &t, 0, 6 )
+			&& est_trouve( &t, 1, 6 )
+			&& est_trouve( &t, 1, 7 )
+			// Ordre des signalements : par position, puis par motif.
+			&& t.motif[0] == 0 && t.fin[0] == 3
+			&& t.motif[1] == 1 && t.fin[1] == 3
+			, result
+		);
+
+		TEST(
+			1
+			&& le_mot_est_reconnu( get_automate_des_motifs( motifs ), "ab" )
+			&& le_mot_est_reconnu( get_automate_des_motifs( motifs ), "b" )
+			&& le_mot_est_reconnu( get_automate_des_motifs( motifs ), "ababc" )
+			&& ! le_mot_est_reconnu( get_automate_des_motifs( motifs ), "a" )
+			, result
+		);
+
+		liberer_motifs( motifs );
+		liberer_automate( aut0 );
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+	}
+
+	{
+		// Deux motifs identiques partagent les mêmes positions, et un motif
+		// reconnaissant le mot vide est trouvé à toutes les positions.
+		const Automate * automates[3];
+		Automate * aut0 = mot_to_automate("aa");
+		Automate * aut1 = mot_to_automate("");
+		Automate * aut2 = mot_to_automate("aa");
+		automates[0] = aut0;
+		automates[1] = aut1;
+		automates[2] = aut2;
+
+		Motifs * motifs = compiler_motifs( automates, 3 );
+
+		Trouves t;
+		t.nb = 0;
+		chercher_motifs( motifs, "aaa", action_test_motifs, &t );
+
+		TEST(
+			1
+			&& t.nb == 8
+			&& est_trouve( &t, 1, 0 )
+			&& est_trouve( &t, 1, 1 )
+			&& est_trouve( &t, 1, 2 )
+			&& est_trouve( &t, 1, 3 )
+			&& est_trouve( &t, 0, 2 )
+			&& est_trouve( &t, 2, 2 )
+			&& est_trouve( &t, 0, 3 )
+			&& est_trouve( &t, 2, 3 )
+			, result
+		);
+
+		liberer_motifs( motifs );
+		liberer_automate( aut0 );
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_motifs() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "outils.h"
+
+#include <stdint.h>
+
+#define N_MAX 2000
+
+/*
+ * Les mots sur {a, b} dont le nombre de 'a' est un multiple de m.
+ */
+Automate * creer_multiples_de_a( int m ){
+	Automate * automate = creer_automate();
+	int i;
+	for( i=0; i<m; i++ ){
+		ajouter_transition( automate, i, 'a', ( i + 1 ) % m );
+		ajouter_transition( automate, i, 'b', i );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	return automate;
+}
+
+/*
+ * Somme des coefficients binomiaux C(n, k) pour k multiple de m, modulo 2^64.
+ */
+uint64_t somme_binomiaux( int n, int m ){
+	static uint64_t ligne[N_MAX+1];
+	int i, k;
+	ligne[0] = 1;
+	for( i=1; i<=n; i++ ){
+		ligne[i] = 1;
+		for( k=i-1; k>0; k-- ){
+			ligne[k] += ligne[k-1];
+		}
+	}
+	uint64_t somme = 0;
+	for( k=0; k<=n; k+=m ){
+		somme += ligne[k];
+	}
+	return somme;
+}
+
+int test_nombre_de_mots(){
+
+	int result = 1;
+
+	{
+		Automate * aut = mot_to_automate( "abc" );
+		Automate * vide = creer_automate();
+		TEST(
+			1
+			&& nombre_de_mots_de_longueur( aut, 3 ) == 1
+			&& nombre_de_mots_de_longueur( aut, 2 ) == 0
+			&& nombre_de_mots_de_longueur( aut, 0 ) == 0
+			&& nombre_de_mots_de_longueur( vide, 0 ) == 0
+			&& nombre_de_mots_de_longueur( vide, 10 ) == 0
+			, result
+		);
+		liberer_automate( aut );
+		liberer_automate( vide );
+	}
+
+	{
+		// Par programmation dynamique (petites longueurs) puis par puissance
+		// de matrice (grandes longueurs).
+		Automate * aut = creer_multiples_de_a( 7 );
+		TEST(
+			1
+			&& nombre_de_mots_de_longueur( aut, 0 ) == 1
+			&& nombre_de_mots_de_longueur( aut, 1 ) == 1
+			&& nombre_de_mots_de_longueur( aut, 7 ) == 2
+			&& nombre_de_mots_de_longueur( aut, 100 ) == somme_binomiaux( 100, 7 )
+			&& nombre_de_mots_de_longueur( aut, 2000 ) == somme_binomiaux( 2000, 7 )
+			, result
+		);
+		liberer_automate( aut );
+	}
+
+	{
+		// Tous les mots sur {a, b, c}, non déterministe : 3^n modulo 2^64.
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 0 );
+		ajouter_transition( aut, 0, 'b', 0 );
+		ajouter_transition( aut, 0, 'c', 0 );
+		ajouter_transition( aut, 0, 'a', 1 );
+		ajouter_transition( aut, 1, 'a', 1 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 0 );
+		ajouter_etat_final( aut, 1 );
+
+		uint64_t puissance = 1;
+		int i;
+		for( i=0; i<100000; i++ ) puissance *= 3;
+
+		TEST(
+			1
+			&& nombre_de_mots_de_longueur( aut, 5 ) == 243
+			&& nombre_de_mots_de_longueur( aut, 100000 ) == puissance
+			, result
+		);
+		liberer_automate( aut );
+	}
+
+	{
+		// Les mots sans deux 'b' consécutifs : suite de Fibonacci.
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 0 );
+		ajouter_transition( aut, 0, 'b', 1 );
+		ajouter_transition( aut, 1, 'a', 0 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 0 );
+		ajouter_etat_final( aut, 1 );
+
+		uint64_t f0 = 1, f1 = 2;
+		int i;
+		for( i=1; i<100000; i++ ){
+			uint64_t f = f0 + f1;
+			f0 = f1;
+			f1 = f;
+		}
+
+		Automate_dense * dense = compiler_automate( aut );
+		TEST(
+			1
+			&& nombre_de_mots_de_longueur_dense( dense, 1 ) == 2
+			&& nombre_de_mots_de_longueur_dense( dense, 4 ) == 8
+			&& nombre_de_mots_de_longueur_dense( dense, 100000 ) == f1
+			&& le_mot_est_reconnu_dense( dense, "abaab" )
+			&& ! le_mot_est_reconnu_dense( dense, "abba" )
+			&& ! le_mot_est_reconnu_dense( dense, "ac" )
+			, result
+		);
+		liberer_automate_dense( dense );
+		liberer_automate( aut );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_nombre_de_mots() ){ return 1; }
+
+	return 0;
+}
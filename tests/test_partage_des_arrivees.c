@@ -0,0 +1,164 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "outils.h"
+
+/*
+ * Renvoie 1 si le partage des ensembles d'arrivée de l'automate est celui
+ * attendu.
+ */
+int partage_attendu(
+	const Automate * automate, int nb_couples, int nb_ensembles, int nb_fins,
+	int nb_fins_stockees
+){
+	Partage_des_arrivees partage = partage_des_arrivees( automate );
+	return
+		partage.nb_couples == nb_couples
+		&& partage.nb_ensembles == nb_ensembles
+		&& partage.nb_fins == nb_fins
+		&& partage.nb_fins_stockees == nb_fins_stockees;
+}
+
+int test_partage_des_arrivees(){
+
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 0, 'a', 2 );
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_transition( automate, 1, 'a', 1 );
+		ajouter_transition( automate, 2, 'b', 1 );
+		ajouter_transition( automate, 2, 'b', 2 );
+		ajouter_transition( automate, 3, 'a', 3 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+
+		// {1, 2} n'est stocké qu'une fois pour trois couples.
+		TEST( partage_attendu( automate, 4, 2, 7, 3 ), result );
+
+		// Modifier un ensemble partagé ne modifie pas les autres couples.
+		ajouter_transition( automate, 0, 'a', 5 );
+		TEST(
+			1
+			&& partage_attendu( automate, 4, 3, 8, 6 )
+			&& est_une_transition_de_l_automate( automate, 0, 'a', 5 )
+			&& ! est_une_transition_de_l_automate( automate, 1, 'a', 5 )
+			&& ! est_une_transition_de_l_automate( automate, 2, 'b', 5 )
+			&& le_mot_est_reconnu( automate, "aab" )
+			, result
+		);
+
+		// Le retrait rejoint un ensemble existant : {3}.
+		retirer_transition( automate, 0, 'a', 5 );
+		retirer_transition( automate, 1, 'a', 1 );
+		retirer_transition( automate, 1, 'a', 2 );
+		ajouter_transition( automate, 1, 'a', 3 );
+		TEST(
+			1
+			&& partage_attendu( automate, 4, 2, 6, 3 )
+			&& est_une_transition_de_l_automate( automate, 0, 'a', 1 )
+			&& est_une_transition_de_l_automate( automate, 2, 'b', 1 )
+			&& est_une_transition_de_l_automate( automate, 1, 'a', 3 )
+			&& ! est_une_transition_de_l_automate( automate, 1, 'a', 1 )
+			, result
+		);
+
+		retirer_etat( automate, 3 );
+		TEST(
+			1
+			&& partage_attendu( automate, 2, 1, 4, 2 )
+			&& ! le_mot_est_reconnu( automate, "aa" )
+			&& le_mot_est_reconnu( automate, "ab" )
+			, result
+		);
+
+		liberer_automate( automate );
+	}
+
+	{
+		// Une copie modifiée a son propre partage, l'original garde le sien.
+		Automate * automate = creer_automate();
+		int i;
+		for( i=0; i<10; i++ ){
+			ajouter_transition( automate, i, 'a', 0 );
+			ajouter_transition( automate, i, 'b', 0 );
+		}
+		Automate * copie = copier_automate( automate );
+		ajouter_transition( copie, 4, 'b', 7 );
+		TEST(
+			1
+			&& partage_attendu( automate, 20, 1, 20, 1 )
+			&& partage_attendu( copie, 20, 2, 21, 3 )
+			&& est_une_transition_de_l_automate( copie, 4, 'b', 7 )
+			&& ! est_une_transition_de_l_automate( automate, 4, 'b', 7 )
+			, result
+		);
+		liberer_automate( copie );
+
+		// Le miroir partage aussi ses ensembles : {0, ..., 9} deux fois.
+		Automate * mir = miroir( automate );
+		TEST( partage_attendu( mir, 2, 1, 20, 10 ), result );
+		liberer_automate( mir );
+		liberer_automate( automate );
+	}
+
+	{
+		// Le déterminisé du mélange : ensembles d'arrivée des singletons,
+		// très souvent identiques.
+		Automate * aut1 = mot_to_automate( "abab" );
+		Automate * aut2 = mot_to_automate( "baba" );
+		long vivantes = (long) nombre_d_allocations() - (long) nombre_de_liberations();
+		Automate * melange = creer_automate_du_melange( aut1, aut2 );
+		Automate * deterministe = determiniser( melange );
+		Partage_des_arrivees partage = partage_des_arrivees( deterministe );
+		TEST(
+			1
+			&& partage.nb_fins == partage.nb_couples
+			&& partage.nb_ensembles < partage.nb_couples
+			&& le_mot_est_reconnu( deterministe, "abbaabba" )
+			&& ! le_mot_est_reconnu( deterministe, "abbaabb" )
+			, result
+		);
+		liberer_automate( deterministe );
+		liberer_automate( melange );
+		TEST(
+			(long) nombre_d_allocations() - (long) nombre_de_liberations()
+				== vivantes
+			, result
+		);
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_partage_des_arrivees() ){ return 1; }
+
+	return 0;
+}
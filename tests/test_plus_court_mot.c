@@ -0,0 +1,154 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "outils.h"
+
+#include <string.h>
+
+int distance( const Automate * automate, const int * distances, int etat ){
+	return distances[ indice_de_l_etat( automate, etat ) ];
+}
+
+int test_plus_court_mot(){
+
+	int result = 1;
+
+	{
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'b', 1 );
+		ajouter_transition( aut, 0, 'a', 2 );
+		ajouter_transition( aut, 1, 'a', 3 );
+		ajouter_transition( aut, 2, 'b', 3 );
+		ajouter_transition( aut, 2, 'a', 2 );
+		ajouter_transition( aut, 3, 'c', 4 );
+		ajouter_transition( aut, 5, 'a', 3 );
+		ajouter_transition( aut, 1, 'c', 6 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 4 );
+
+		char * mot = plus_court_mot( aut );
+		int * distances = creer_distances_aux_etats_finaux( aut );
+		TEST(
+			1
+			&& ! est_vide_langage( aut )
+			&& mot && strcmp( mot, "abc" ) == 0
+			&& distance( aut, distances, 4 ) == 0
+			&& distance( aut, distances, 3 ) == 1
+			&& distance( aut, distances, 2 ) == 2
+			&& distance( aut, distances, 1 ) == 2
+			&& distance( aut, distances, 0 ) == 3
+			&& distance( aut, distances, 5 ) == 2
+			&& distance( aut, distances, 6 ) == -1
+			, result
+		);
+		xfree( mot );
+		xfree( distances );
+
+		// L'état 5 n'est pas accessible.
+		ajouter_etat_initial( aut, 5 );
+		mot = plus_court_mot( aut );
+		TEST( mot && strcmp( mot, "ac" ) == 0, result );
+		xfree( mot );
+
+		ajouter_etat_final( aut, 5 );
+		mot = plus_court_mot( aut );
+		TEST( mot && strcmp( mot, "" ) == 0, result );
+		xfree( mot );
+
+		liberer_automate( aut );
+	}
+
+	{
+		Automate * aut = creer_automate();
+		ajouter_transition( aut, 0, 'a', 1 );
+		ajouter_transition( aut, 1, 'a', 0 );
+		ajouter_transition( aut, 2, 'a', 3 );
+		ajouter_etat_initial( aut, 0 );
+		ajouter_etat_final( aut, 3 );
+
+		Automate * vide = creer_automate();
+
+		char * mot = plus_court_mot( aut );
+		TEST(
+			1
+			&& est_vide_langage( aut )
+			&& mot == NULL
+			&& est_vide_langage( vide )
+			, result
+		);
+		xfree( mot );
+
+		// Le complémentaire reconnaît tout, avec un puits implicite final.
+		Automate * comp = complementer( aut );
+		ajouter_lettre( aut, 'b' );
+		Automate * comp_b = complementer( aut );
+		Automate * det = determiniser( comp_b );
+		Automate * comp_comp = complementer( det );
+
+		char * mot_comp = plus_court_mot( comp );
+		TEST(
+			1
+			&& ! est_vide_langage( comp )
+			&& mot_comp && strcmp( mot_comp, "" ) == 0
+			&& est_vide_langage( comp_comp )
+			, result
+		);
+		xfree( mot_comp );
+
+		// Les transitions implicites vers le puits sont prises en compte, et
+		// rangées avec les autres par ordre de lettre.
+		Automate * b = creer_automate();
+		ajouter_transition( b, 0, 'b', 1 );
+		ajouter_lettre( b, 'a' );
+		ajouter_etat_initial( b, 0 );
+		ajouter_etat_final( b, 0 );
+		Automate * comp_b_seul = complementer( b );
+		char * mot_b = plus_court_mot( comp_b_seul );
+		TEST(
+			1
+			&& a_un_etat_puits( comp_b_seul )
+			&& mot_b && strcmp( mot_b, "a" ) == 0
+			, result
+		);
+		xfree( mot_b );
+		liberer_automate( b );
+		liberer_automate( comp_b_seul );
+
+		liberer_automate( comp );
+		liberer_automate( comp_b );
+		liberer_automate( det );
+		liberer_automate( comp_comp );
+		liberer_automate( aut );
+		liberer_automate( vide );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_plus_court_mot() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "outils.h"
+
+int test_predecesseurs(){
+
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 3, 'a', 1 );
+		ajouter_transition( automate, 2, 'a', 1 );
+		ajouter_transition( automate, 1, 'b', 1 );
+		ajouter_transition( automate, 2, '\377', 1 );
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_etat( automate, 4 );
+
+		Predecesseurs * predecesseurs = creer_predecesseurs( automate );
+		int nb_a, nb_b, nb_ff, nb_vers_3, nb_inconnu;
+		const int * a = get_origines( predecesseurs, 1, 'a', &nb_a );
+		const int * b = get_origines( predecesseurs, 1, 'b', &nb_b );
+		const int * ff = get_origines( predecesseurs, 1, '\377', &nb_ff );
+		get_origines( predecesseurs, 3, 'a', &nb_vers_3 );
+		get_origines( predecesseurs, 42, 'a', &nb_inconnu );
+
+		TEST(
+			1
+			&& nb_a == 2
+			&& ( ( a[0] == 2 && a[1] == 3 ) || ( a[0] == 3 && a[1] == 2 ) )
+			&& nb_b == 1 && b[0] == 1
+			&& nb_ff == 1 && ff[0] == 2
+			&& nb_vers_3 == 0
+			&& nb_inconnu == 0
+			, result
+		);
+
+		Ensemble * etats = creer_ensemble( NULL, NULL, NULL );
+		ajouter_element( etats, 1 );
+		ajouter_element( etats, 2 );
+		Ensemble * origines = delta_inverse( predecesseurs, etats, 'a' );
+		TEST(
+			1
+			&& taille_ensemble( origines ) == 3
+			&& est_dans_l_ensemble( origines, 1 )
+			&& est_dans_l_ensemble( origines, 2 )
+			&& est_dans_l_ensemble( origines, 3 )
+			, result
+		);
+
+		liberer_ensemble( origines );
+		liberer_ensemble( etats );
+		liberer_predecesseurs( predecesseurs );
+		liberer_automate( automate );
+	}
+
+	{
+		// Les transitions implicites vers le puits sont indexées.
+		Automate * automate = mot_to_automate( "ab" );
+		Automate * complement = complementer( automate );
+		const Ensemble * depuis_initial = delta1(
+			complement, get_element( premier_iterateur_ensemble(
+				get_initiaux( complement )
+			) ), 'b'
+		);
+		int puits = get_element( premier_iterateur_ensemble( depuis_initial ) );
+
+		Predecesseurs * predecesseurs = creer_predecesseurs( complement );
+		int nb;
+		get_origines( predecesseurs, puits, 'b', &nb );
+		TEST(
+			1
+			&& nb == 3 // l'initial, l'état après "ab" et le puits lui-même
+			, result
+		);
+
+		Automate * mir = miroir( complement );
+		TEST(
+			1
+			&& ! le_mot_est_reconnu( mir, "ba" )
+			&& le_mot_est_reconnu( mir, "bba" )
+			&& le_mot_est_reconnu( mir, "ab" )
+			&& le_mot_est_reconnu( mir, "" )
+			, result
+		);
+
+		liberer_automate( mir );
+		liberer_predecesseurs( predecesseurs );
+		liberer_ensemble( (Ensemble*) depuis_initial );
+		liberer_automate( complement );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_predecesseurs() ){ return 1; }
+
+	return 0;
+}
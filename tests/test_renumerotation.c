@@ -0,0 +1,154 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "outils.h"
+
+/*
+ * Renvoie 1 si les deux automates compilés reconnaissent les mêmes mots
+ * parmi 'mots'.
+ */
+int memes_mots( const Automate_dense * a, const Automate_dense * b, const char ** mots ){
+	for( ; *mots; mots++ ){
+		if( le_mot_est_reconnu_dense( a, *mots ) != le_mot_est_reconnu_dense( b, *mots ) ){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int test_renumerotation(){
+
+	int result = 1;
+
+	const char * mots[] = {
+		"", "a", "b", "ab", "ba", "abb", "bab", "abab", "bbab", "aabba", NULL
+	};
+
+	{
+		// Les mots sur {a, b} dont l'avant-dernière lettre est un a.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 0 );
+		ajouter_transition( automate, 0, 'b', 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_transition( automate, 1, 'b', 2 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+
+		Automate_dense * reference = compiler_automate( automate );
+		Automate_dense * dense = compiler_automate( automate );
+
+		// Un ordre quelconque : les états à l'envers.
+		int i, n = dense->nb_etats;
+		int * ordre = xmalloc( n * sizeof(int) );
+		for( i=0; i<n; i++ ) ordre[i] = n - 1 - i;
+		renumeroter_automate_dense( dense, ordre );
+		xfree( ordre );
+		TEST(
+			1
+			&& dense->nb_etats == 4
+			&& dense->initial == n - 1
+			&& memes_mots( reference, dense, mots )
+			&& nombre_de_mots_de_longueur_dense( dense, 5 ) == 16
+			, result
+		);
+
+		// En largeur, l'initial passe en tête et chaque état suit ceux qui
+		// le précèdent dans le parcours.
+		ordre = ordre_en_largeur_dense( dense );
+		renumeroter_automate_dense( dense, ordre );
+		xfree( ordre );
+		int largeur = 1;
+		for( i=0; i<n; i++ ){
+			int c;
+			for( c=0; c<dense->nb_colonnes; c++ ){
+				int fin = dense->transitions[ i * dense->nb_colonnes + c ];
+				// Un successeur d'un état rangé en i ne peut être rangé
+				// au-delà des successeurs des états 0 à i.
+				if( fin > ( i + 1 ) * dense->nb_colonnes ) largeur = 0;
+			}
+		}
+		TEST(
+			1
+			&& dense->initial == 0
+			&& largeur
+			&& memes_mots( reference, dense, mots )
+			, result
+		);
+
+		// En profondeur, l'initial reste en tête.
+		ordre = ordre_en_profondeur_dense( dense );
+		renumeroter_automate_dense( dense, ordre );
+		xfree( ordre );
+		TEST(
+			1
+			&& dense->initial == 0
+			&& memes_mots( reference, dense, mots )
+			, result
+		);
+
+		// Par profil, le chemin de "ab" occupe les premiers états.
+		const char * echantillon[] = { "ab", "ab", "bbbb" };
+		ordre = ordre_par_profil_dense( dense, echantillon, 3 );
+		renumeroter_automate_dense( dense, ordre );
+		xfree( ordre );
+		TEST(
+			1
+			&& dense->initial == 0
+			&& transition_dense( dense, 0, 'a' ) == 1
+			&& transition_dense( dense, 1, 'b' ) == 2
+			&& memes_mots( reference, dense, mots )
+			, result
+		);
+
+		liberer_automate_dense( dense );
+		liberer_automate_dense( reference );
+		liberer_automate( automate );
+	}
+
+	{
+		// Les états inaccessibles sont rangés à la fin.
+		Automate * automate = mot_to_automate( "ab" );
+		Automate_dense * dense = compiler_automate( automate );
+		dense->initial = -1;
+		int * ordre = ordre_en_largeur_dense( dense );
+		int i, identite = 1;
+		for( i=0; i<dense->nb_etats; i++ ){
+			if( ordre[i] != i ) identite = 0;
+		}
+		TEST( identite, result );
+		xfree( ordre );
+		liberer_automate_dense( dense );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_renumerotation() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,231 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "outils.h"
+
+// Les transitions construites sont toutes distinctes.
+#define NB_TRANSITIONS 120
+#define NB_ETATS 40
+
+typedef struct {
+	const Automate * autre;
+	int nb;
+	int identiques;
+} Comparaison;
+
+void action_comparer_transitions( int origine, char lettre, int fin, void* data ){
+	Comparaison * c = (Comparaison*) data;
+	c->nb++;
+	if( ! est_une_transition_de_l_automate( c->autre, origine, lettre, fin ) ){
+		c->identiques = 0;
+	}
+}
+
+/*
+ * Renvoie 1 si les deux automates ont exactement les mêmes transitions.
+ */
+int memes_transitions( const Automate * a, const Automate * b ){
+	Comparaison ab = { b, 0, 1 };
+	Comparaison ba = { a, 0, 1 };
+	pour_toute_transition( a, action_comparer_transitions, &ab );
+	pour_toute_transition( b, action_comparer_transitions, &ba );
+	return ab.identiques && ba.identiques && ab.nb == ba.nb;
+}
+
+/*
+ * Renvoie 1 si les indices des états sont 0, 1, ..., |Q|-1 et si les états
+ * extrêmes sont à jour.
+ */
+int indices_coherents( const Automate * automate ){
+	int n = taille_ensemble( get_etats( automate ) );
+	int i;
+	for( i=0; i<n; i++ ){
+		int etat = etat_de_l_indice( automate, i );
+		if(
+			! est_un_etat_de_l_automate( automate, etat )
+			|| indice_de_l_etat( automate, etat ) != i
+		){
+			return 0;
+		}
+	}
+	if( n == 0 ) return 1;
+	return get_min_etat( automate ) == get_element(
+		premier_iterateur_ensemble( get_etats( automate ) )
+	) && get_max_etat( automate ) == get_element(
+		dernier_iterateur_ensemble( get_etats( automate ) )
+	);
+}
+
+int test_retirer(){
+
+	int result = 1;
+
+	{
+		Automate * automate = mot_to_automate( "abc" );
+		retirer_transition( automate, 1, 'b', 2 );
+		retirer_transition( automate, 1, 'c', 2 );
+		TEST(
+			1
+			&& ! le_mot_est_reconnu( automate, "abc" )
+			&& ! est_une_transition_de_l_automate( automate, 1, 'b', 2 )
+			&& est_une_transition_de_l_automate( automate, 0, 'a', 1 )
+			&& est_une_transition_de_l_automate( automate, 2, 'c', 3 )
+			&& taille_ensemble( get_etats( automate ) ) == 4
+			&& est_une_lettre_de_l_automate( automate, 'b' )
+			, result
+		);
+
+		// L'état 0 est initial, le plus petit, et d'indice 0 : le dernier
+		// indice prend sa place.
+		retirer_etat( automate, 0 );
+		retirer_etat( automate, 17 );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( automate ) ) == 3
+			&& taille_ensemble( get_initiaux( automate ) ) == 0
+			&& ! est_une_transition_de_l_automate( automate, 0, 'a', 1 )
+			&& indice_de_l_etat( automate, 0 ) == -1
+			&& indice_de_l_etat( automate, 3 ) == 0
+			&& get_min_etat( automate ) == 1
+			&& get_max_etat( automate ) == 3
+			&& indices_coherents( automate )
+			, result
+		);
+
+		retirer_etat( automate, 3 );
+		retirer_etat( automate, 2 );
+		retirer_etat( automate, 1 );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( automate ) ) == 0
+			&& taille_ensemble( get_finaux( automate ) ) == 0
+			&& indices_coherents( automate )
+			, result
+		);
+		ajouter_transition( automate, 5, 'a', 6 );
+		TEST(
+			1
+			&& get_min_etat( automate ) == 5
+			&& get_max_etat( automate ) == 6
+			&& indice_de_l_etat( automate, 6 ) == 1
+			, result
+		);
+		liberer_automate( automate );
+	}
+
+	{
+		// Des retraits successifs, avec ou sans l'index des transitions par
+		// état d'arrivée, donnent le même automate qu'une construction sans
+		// les transitions retirées. L'index est tenu à jour par les ajouts
+		// et partagé par les copies.
+		Transition transitions[NB_TRANSITIONS];
+		Transition restantes[NB_TRANSITIONS];
+		int i, nb_restantes = 0;
+		for( i=0; i<NB_TRANSITIONS; i++ ){
+			transitions[i].origine = ( i * 7 ) % NB_ETATS;
+			transitions[i].lettre = 'a' + i % 3;
+			transitions[i].fin = ( i * 11 + 3 ) % NB_ETATS;
+		}
+		Automate * automate = creer_automate_a_partir_de(
+			NULL, NULL, NULL, NULL, transitions, NB_TRANSITIONS
+		);
+		indexer_predecesseurs( automate );
+		Automate * sans_index = creer_automate_a_partir_de(
+			NULL, NULL, NULL, NULL, transitions, NB_TRANSITIONS
+		);
+		Automate * copie = copier_automate( automate );
+		ajouter_transition( copie, 0, 'z', 1 );
+
+		for( i=0; i<NB_TRANSITIONS; i++ ){
+			int origine = transitions[i].origine, fin = transitions[i].fin;
+			if( origine % 5 == 0 || fin % 5 == 0 ) continue;
+			if( i % 4 == 0 ) continue;
+			restantes[ nb_restantes++ ] = transitions[i];
+		}
+		for( i=0; i<NB_TRANSITIONS; i+=4 ){
+			retirer_transition(
+				automate, transitions[i].origine, transitions[i].lettre,
+				transitions[i].fin
+			);
+			retirer_transition(
+				sans_index, transitions[i].origine, transitions[i].lettre,
+				transitions[i].fin
+			);
+		}
+		for( i=0; i<NB_ETATS; i+=5 ){
+			retirer_etat( automate, i );
+			retirer_etat( sans_index, i );
+		}
+		retirer_etat( copie, 1 );
+
+		Automate * attendu = creer_automate_a_partir_de(
+			NULL, NULL, NULL, NULL, restantes, nb_restantes
+		);
+		TEST(
+			1
+			&& memes_transitions( automate, attendu )
+			&& taille_ensemble( get_etats( automate ) ) == NB_ETATS - NB_ETATS / 5
+			&& indices_coherents( automate )
+			&& memes_transitions( sans_index, attendu )
+			&& ! est_une_transition_de_l_automate( copie, 0, 'z', 1 )
+			&& ! est_une_lettre_de_l_automate( automate, 'z' )
+			&& taille_ensemble( get_etats( copie ) ) == NB_ETATS - 1
+			, result
+		);
+
+		liberer_automate( attendu );
+		liberer_automate( copie );
+		liberer_automate( sans_index );
+		liberer_automate( automate );
+	}
+
+	{
+		// Retirer l'état puits implicite.
+		Automate * aut = mot_to_automate( "a" );
+		Automate * complement = complementer( aut );
+		int puits = get_etat_puits( complement );
+		retirer_etat( complement, puits );
+		TEST(
+			1
+			&& ! a_un_etat_puits( complement )
+			&& ! est_un_etat_de_l_automate( complement, puits )
+			&& ! le_mot_est_reconnu( complement, "b" )
+			&& ! le_mot_est_reconnu( complement, "a" )
+			&& le_mot_est_reconnu( complement, "" )
+			&& indices_coherents( complement )
+			, result
+		);
+		liberer_automate( complement );
+		liberer_automate( aut );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_retirer() ){ return 1; }
+
+	return 0;
+}
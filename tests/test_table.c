@@ -391,10 +391,212 @@ int test_trouver_table(){
 
 	liberer_table( table );
 
+	// L'association est rangée dans le nœud : une seule allocation par
+	// entrée, plus la copie de la clé, et aucune pour une recherche.
+	table = creer_table(
+		( int(*)(const intptr_t, const intptr_t) ) comparer_cle,
+		( intptr_t (*)( const intptr_t ) ) copier_cle,
+		( void(*)(intptr_t) ) supprimer_cle
+	);
+	Cle cle;
+	initialiser_cle( &cle, 7 );
+	unsigned long allocations = nombre_d_allocations();
+	add_table( table, (intptr_t) &cle, 1 );
+	unsigned long allocations_ajout = nombre_d_allocations() - allocations;
+
+	allocations = nombre_d_allocations();
+	add_table( table, (intptr_t) &cle, 2 );
+	Table_iterateur it = trouver_table( table, (intptr_t) &cle );
+	Table_iterateur it_a_partir_de =
+		premier_iterateur_table_a_partir_de( table, (intptr_t) &cle );
+	TEST(
+		1
+		&& nombre_d_allocations() == allocations
+		&& allocations_ajout == 2
+		&& get_valeur( it ) == 2
+		&& get_valeur( it_a_partir_de ) == 2
+		&& ((Cle*) get_cle( it ))->cle == 7
+		&& get_cle( it ) != (intptr_t) &cle
+		, result
+	);
+
+	unsigned long liberations = nombre_de_liberations();
+	delete_table( table, (intptr_t) &cle );
+	TEST(
+		1
+		&& nombre_d_allocations() == allocations
+		&& nombre_de_liberations() - liberations == 2
+		&& taille_table( table ) == 0
+		, result
+	);
+	liberer_table( table );
+
 	// Voir general_test;
 	return result;
 }
 
+int test_premier_iterateur_table_a_partir_de(){
+	int result = 1;
+	Table * table = creer_table( NULL, NULL, NULL );
+
+	int i;
+	for( i=0; i<100; i+=10 ){
+		add_table( table, i, i );
+	}
+
+	TEST( get_cle( premier_iterateur_table_a_partir_de( table, 30 ) ) == 30, result );
+	TEST( get_cle( premier_iterateur_table_a_partir_de( table, 31 ) ) == 40, result );
+	TEST( get_cle( premier_iterateur_table_a_partir_de( table, -5 ) ) == 0, result );
+	TEST( iterateur_est_vide( premier_iterateur_table_a_partir_de( table, 91 ) ), result );
+	TEST( get_cle( dernier_iterateur_table( table ) ) == 90, result );
+
+	// L'itérateur obtenu se parcourt comme les autres.
+	int somme = 0;
+	Table_iterateur it;
+	for(
+		it = premier_iterateur_table_a_partir_de( table, 55 );
+		! iterateur_est_vide( it );
+		it = iterateur_suivant_table( it )
+	){
+		somme += get_cle( it );
+	}
+	TEST( somme == 60 + 70 + 80 + 90, result );
+	it = iterateur_precedent_table( premier_iterateur_table_a_partir_de( table, 55 ) );
+	TEST( get_cle( it ) == 50, result );
+
+	liberer_table( table );
+	return result;
+}
+
+intptr_t multiplier_valeur( const intptr_t valeur, void* data ){
+	return valeur * *(int*) data;
+}
+
+int test_copier_table(){
+	int result = 1;
+	Table * table = creer_table(
+		( int(*)(const intptr_t, const intptr_t) ) comparer_cle,
+		( intptr_t (*)( const intptr_t ) ) copier_cle,
+		( void(*)(intptr_t) ) supprimer_cle
+	);
+	int i;
+	for( i=0; i<50; i++ ){
+		Cle cle;
+		initialiser_cle( &cle, i * 3 );
+		add_table( table, (intptr_t) &cle, i );
+	}
+
+	int facteur = 2;
+	Table * copie = copier_table( table, multiplier_valeur, &facteur );
+	Table * copie_brute = copier_table( table, NULL, NULL );
+	liberer_table( table );
+
+	Cle cle;
+	initialiser_cle( &cle, 27 );
+	set_valeur( trouver_table( copie_brute, (intptr_t) &cle ), 100 );
+	TEST(
+		1
+		&& taille_table( copie ) == 50
+		&& get_valeur( trouver_table( copie, (intptr_t) &cle ) ) == 18
+		&& get_valeur( trouver_table( copie_brute, (intptr_t) &cle ) ) == 100
+		, result
+	);
+
+	// Les clés de la copie sont indépendantes.
+	delete_table( copie, (intptr_t) &cle );
+	TEST(
+		1
+		&& taille_table( copie ) == 49
+		&& taille_table( copie_brute ) == 50
+		, result
+	);
+
+	liberer_table( copie );
+	liberer_table( copie_brute );
+	return result;
+}
+
+int test_copier_table_partagee(){
+	int result = 1;
+	long vivantes = (long) nombre_d_allocations() - (long) nombre_de_liberations();
+	Table * table = creer_table(
+		( int(*)(const intptr_t, const intptr_t) ) comparer_cle,
+		( intptr_t (*)( const intptr_t ) ) copier_cle,
+		( void(*)(intptr_t) ) supprimer_cle
+	);
+	int i;
+	for( i=0; i<1000; i++ ){
+		Cle cle;
+		initialiser_cle( &cle, i );
+		add_table( table, (intptr_t) &cle, i );
+	}
+
+	// Chaque version ne recopie que le chemin qu'elle modifie.
+	Table * versions[10];
+	versions[0] = table;
+	unsigned long allocations = nombre_d_allocations();
+	for( i=1; i<10; i++ ){
+		Cle cle;
+		versions[i] = copier_table( versions[i-1], NULL, NULL );
+		initialiser_cle( &cle, 1000 + i );
+		add_table( versions[i], (intptr_t) &cle, i );
+		initialiser_cle( &cle, i );
+		delete_table( versions[i], (intptr_t) &cle );
+		initialiser_cle( &cle, 500 );
+		set_valeur( trouver_table( versions[i], (intptr_t) &cle ), -i );
+	}
+	TEST( nombre_d_allocations() - allocations < 9 * 200, result );
+
+	for( i=0; i<10; i++ ){
+		Cle cle;
+		int k, identiques = 1;
+		for( k=0; k<1010; k++ ){
+			initialiser_cle( &cle, k );
+			Table_iterateur it = trouver_table( versions[i], (intptr_t) &cle );
+			int present =
+				( k < 1000 && ( k == 0 || k > i ) )
+				|| ( k > 1000 && k <= 1000 + i );
+			if( iterateur_est_vide( it ) == present ) identiques = 0;
+			if(
+				present && k != 500
+				&& get_valeur( it ) != ( k < 1000 ? k : k - 1000 )
+			){
+				identiques = 0;
+			}
+		}
+		initialiser_cle( &cle, 500 );
+		TEST(
+			1
+			&& identiques
+			&& taille_table( versions[i] ) == 1000
+			&& get_valeur( trouver_table( versions[i], (intptr_t) &cle ) )
+				== ( i == 0 ? 500 : -i )
+			, result
+		);
+	}
+
+	// Les versions survivent à celles dont elles sont issues.
+	for( i=0; i<9; i++ ){
+		liberer_table( versions[i] );
+	}
+	Cle cle;
+	initialiser_cle( &cle, 999 );
+	TEST(
+		1
+		&& taille_table( versions[9] ) == 1000
+		&& get_valeur( trouver_table( versions[9], (intptr_t) &cle ) ) == 999
+		, result
+	);
+	vider_table( versions[9] );
+	liberer_table( versions[9] );
+	TEST(
+		(long) nombre_d_allocations() - (long) nombre_de_liberations()
+			== vivantes
+		, result
+	);
+	return result;
+}
+
 int test_get_cle(){
 	// Voir general_test
 	return 1;
@@ -418,6 +620,9 @@ int main(){
 	result &= test_vider_table();
 //	result &= test_print_table();
 	result &= test_pour_toute_valeur_table();
+	result &= test_premier_iterateur_table_a_partir_de();
+	result &= test_copier_table();
+	result &= test_copier_table_partagee();
 	result &= test_pour_toute_cle_valeur_table();
 	result &= test_trouver_table();
 	result &= test_get_cle();
@@ -0,0 +1,109 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "outils.h"
+
+int test_union(){
+
+	int result = 1;
+
+	{
+		Automate * aut1 = mot_to_automate("ab");
+		Automate * aut2 = mot_to_automate("c");
+
+		Automate * uni = creer_union_des_automates( aut1, aut2 );
+
+		TEST(
+			1
+			&& uni
+			&& le_mot_est_reconnu( uni, "ab" )
+			&& le_mot_est_reconnu( uni, "c" )
+			&& ! le_mot_est_reconnu( uni, "" )
+			&& ! le_mot_est_reconnu( uni, "a" )
+			&& ! le_mot_est_reconnu( uni, "abc" )
+			&& ! le_mot_est_reconnu( uni, "cab" )
+			// Les états de aut2 sont conservés, ceux de aut1 translatés.
+			&& est_une_transition_de_l_automate( uni, 0, 'c', 1 )
+			&& est_une_transition_de_l_automate( uni, 2, 'a', 3 )
+			&& est_une_transition_de_l_automate( uni, 3, 'b', 4 )
+			&& taille_ensemble( get_etats( uni ) ) == 5
+			, result
+		);
+		liberer_automate( uni );
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+	}
+
+	{
+		const Automate * automates[4];
+		int translations[4];
+		Automate * aut0 = mot_to_automate("a");
+		Automate * aut1 = creer_automate();
+		Automate * aut2 = creer_automate();
+		Automate * aut3 = mot_to_automate("bb");
+
+		ajouter_transition( aut2, -4, 'c', -4 );
+		ajouter_etat_initial( aut2, -4 );
+		ajouter_etat_final( aut2, -4 );
+
+		automates[0] = aut0;
+		automates[1] = aut1;
+		automates[2] = aut2;
+		automates[3] = aut3;
+
+		Automate * uni = creer_union_de_n_automates( automates, 4, translations );
+
+		TEST(
+			1
+			&& uni
+			&& translations[0] == 0
+			&& translations[1] == 0
+			&& translations[2] == 6
+			&& translations[3] == 3
+			&& taille_ensemble( get_etats( uni ) ) == 6
+			&& taille_ensemble( get_initiaux( uni ) ) == 3
+			&& taille_ensemble( get_finaux( uni ) ) == 3
+			&& le_mot_est_reconnu( uni, "" )
+			&& le_mot_est_reconnu( uni, "a" )
+			&& le_mot_est_reconnu( uni, "ccc" )
+			&& le_mot_est_reconnu( uni, "bb" )
+			&& ! le_mot_est_reconnu( uni, "b" )
+			&& ! le_mot_est_reconnu( uni, "ac" )
+			, result
+		);
+		liberer_automate( uni );
+		liberer_automate( aut0 );
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+		liberer_automate( aut3 );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_union() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "intervalles.h"
+#include "motifs.h"
+#include "outils.h"
+
+#include <stdint.h>
+
+/*
+ * Écrit dans 'mot' l'encodage UTF-8 de 's', suivi de "\n".
+ */
+void encoder_test_utf8( uint32_t s, char * mot ){
+	unsigned char * c = (unsigned char *) mot;
+	if( s < 0x80 ){
+		*c++ = s;
+	}else if( s < 0x800 ){
+		*c++ = 0xC0 | ( s >> 6 );
+		*c++ = 0x80 | ( s & 0x3F );
+	}else if( s < 0x10000 ){
+		*c++ = 0xE0 | ( s >> 12 );
+		*c++ = 0x80 | ( ( s >> 6 ) & 0x3F );
+		*c++ = 0x80 | ( s & 0x3F );
+	}else{
+		*c++ = 0xF0 | ( s >> 18 );
+		*c++ = 0x80 | ( ( s >> 12 ) & 0x3F );
+		*c++ = 0x80 | ( ( s >> 6 ) & 0x3F );
+		*c++ = 0x80 | ( s & 0x3F );
+	}
+	*c++ = '\n';
+	*c = '\0';
+}
+
+void action_test_utf8( int motif, int fin, void* data ){
+	( (int*) data )[motif]++;
+}
+
+int test_utf8(){
+
+	int result = 1;
+
+	{
+		// Une lettre grecque minuscule (α à ω), précédée de n'importe quels
+		// symboles sauf le retour à la ligne.
+		Automate_intervalles * symboles = creer_automate_intervalles();
+		ajouter_transition_symboles( symboles, 0, 1, '\n' - 1, 0 );
+		ajouter_transition_symboles(
+			symboles, 0, '\n' + 1, MAX_SYMBOLE_UNICODE, 0
+		);
+		ajouter_transition_symboles( symboles, 0, 0x3B1, 0x3C9, 1 );
+		ajouter_etat_initial_intervalles( symboles, 0 );
+		ajouter_etat_final_intervalles( symboles, 1 );
+
+		TEST(
+			1
+			&& nombre_de_segments( symboles, 0 ) == 4
+			&& est_dans_l_ensemble( voisins_symbole( symboles, 0, 0x3B2 ), 1 )
+			&& ! est_dans_l_ensemble( voisins_symbole( symboles, 0, 0x3B0 ), 1 )
+			&& le_mot_utf8_est_reconnu_intervalles( symboles, "abc\xce\xb1" )
+			&& le_mot_utf8_est_reconnu_intervalles(
+				symboles, "\xe2\x82\xac\xf0\x9f\x98\x80\xcf\x89"
+			)
+			&& ! le_mot_utf8_est_reconnu_intervalles( symboles, "abc" )
+			&& ! le_mot_utf8_est_reconnu_intervalles( symboles, "\n\xce\xb1" )
+			&& ! le_mot_utf8_est_reconnu_intervalles( symboles, "\xff\xce\xb1" )
+			&& ! le_mot_utf8_est_reconnu_intervalles( symboles, "\xce" )
+			, result
+		);
+
+		Automate_intervalles * octets = abaisser_utf8( symboles );
+		Automate_dense * dense = compiler_automate_intervalles( octets );
+		TEST(
+			1
+			&& dense
+			&& le_mot_est_reconnu_dense( dense, "abc\xce\xb1" )
+			&& le_mot_est_reconnu_dense(
+				dense, "\xe2\x82\xac\xf0\x9f\x98\x80\xcf\x89"
+			)
+			&& ! le_mot_est_reconnu_dense( dense, "abc" )
+			&& ! le_mot_est_reconnu_dense( dense, "\n\xce\xb1" )
+			// Octet invalide, encodage trop long, surrogate, hors Unicode.
+			&& ! le_mot_est_reconnu_dense( dense, "\xff\xce\xb1" )
+			&& ! le_mot_est_reconnu_dense( dense, "\xc0\x80\xce\xb1" )
+			&& ! le_mot_est_reconnu_dense( dense, "\xed\xa0\x80\xce\xb1" )
+			&& ! le_mot_est_reconnu_dense( dense, "\xf4\x90\x80\x80\xce\xb1" )
+			&& ! le_mot_est_reconnu_dense( dense, "\xce" )
+			, result
+		);
+
+		liberer_automate_dense( dense );
+		liberer_automate_intervalles( octets );
+		liberer_automate_intervalles( symboles );
+	}
+
+	{
+		// L'automate abaissé reconnaît exactement l'encodage des symboles
+		// lus par l'automate sur les points de code.
+		Automate_intervalles * symboles = creer_automate_intervalles();
+		ajouter_transition_symboles( symboles, 0, 0x41, 0x5A, 1 );
+		ajouter_transition_symboles( symboles, 0, 0x7E, 0x801, 1 );
+		ajouter_transition_symboles( symboles, 0, 0xD000, 0xE0FF, 1 );
+		ajouter_transition_symboles( symboles, 0, 0xFFF0, 0x10123, 1 );
+		ajouter_transition_symboles( symboles, 0, 0x10FFFE, 0xFFFFFFFF, 1 );
+		ajouter_transition_symboles( symboles, 1, '\n', '\n', 2 );
+		ajouter_etat_initial_intervalles( symboles, 0 );
+		ajouter_etat_final_intervalles( symboles, 2 );
+
+		Automate_intervalles * octets = abaisser_utf8( symboles );
+		Automate_dense * dense = compiler_automate_intervalles( octets );
+
+		int identiques = 1;
+		uint32_t s;
+		char mot[8];
+		for( s=1; s<=MAX_SYMBOLE_UNICODE; s += ( s < 0x11000 ) ? 1 : 0x3F ){
+			if( s >= 0xD800 && s <= 0xDFFF ) continue;
+			encoder_test_utf8( s, mot );
+			if(
+				le_mot_est_reconnu_dense( dense, mot )
+				!= le_mot_utf8_est_reconnu_intervalles( symboles, mot )
+			){
+				identiques = 0;
+			}
+		}
+		encoder_test_utf8( 0x10FFFF, mot );
+		TEST(
+			1
+			&& identiques
+			&& le_mot_est_reconnu_dense( dense, mot )
+			&& le_mot_est_reconnu_dense( dense, "\xe0\xa0\x81\n" )
+			&& ! le_mot_est_reconnu_dense( dense, "\xe0\xa0\x82\n" )
+			, result
+		);
+
+		// Les motifs lisent le texte UTF-8 sans le décoder.
+		Automate * automate = intervalles_vers_automate( octets );
+		const Automate * automates[1] = { automate };
+		Motifs * motifs = compiler_motifs( automates, 1 );
+		int trouves[1] = { 0 };
+		chercher_motifs(
+			motifs, "A\n\xc3\xa9\n\xe2\x82\xac\nz\n", action_test_utf8, trouves
+		);
+		TEST( trouves[0] == 2, result );
+
+		liberer_motifs( motifs );
+		liberer_automate( automate );
+		liberer_automate_dense( dense );
+		liberer_automate_intervalles( octets );
+		liberer_automate_intervalles( symboles );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_utf8() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,232 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "outils.h"
+
+#include <limits.h>
+
+void action_compter_transitions_vue(
+	int origine, char lettre, int fin, void* data
+){
+	int * somme = (int*) data;
+	*somme += origine + fin;
+}
+
+/*
+ * Vérifie que les transitions sont passées en revue par origine puis par
+ * lettre croissantes ; derniere[1] passe à INT_MIN sinon.
+ */
+void action_verifier_ordre( int origine, char lettre, int fin, void* data ){
+	int * derniere = (int*) data;
+	int cle = (unsigned char) lettre;
+	if(
+		origine < derniere[0]
+		|| ( origine == derniere[0] && cle < derniere[1] )
+	){
+		derniere[1] = INT_MIN;
+		return;
+	}
+	if( derniere[1] == INT_MIN ) return;
+	derniere[0] = origine;
+	derniere[1] = cle;
+}
+
+int test_vue(){
+
+	int result = 1;
+
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 1, 'a', 3 );
+	ajouter_transition( automate, 2, 'b', 3 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_etat_final( automate, 3 );
+
+	{
+		Vue_automate vue = vue_automate( automate, 10 );
+
+		Ensemble * ens = delta1_vue( vue, 11, 'a' );
+		Ensemble * courants = creer_ensemble( NULL, NULL, NULL );
+		ajouter_element( courants, 11 );
+		ajouter_element( courants, 12 );
+		Ensemble * ens2 = delta_vue( vue, courants, 'b' );
+		Ensemble * ens3 = delta1_vue( vue, 1, 'a' );
+
+		int somme = 0;
+		pour_toute_transition_vue(
+			vue, action_compter_transitions_vue, &somme
+		);
+
+		TEST(
+			1
+			&& vue.automate == automate
+			&& taille_ensemble( ens ) == 2
+			&& est_dans_l_ensemble( ens, 12 )
+			&& est_dans_l_ensemble( ens, 13 )
+			&& taille_ensemble( ens2 ) == 1
+			&& est_dans_l_ensemble( ens2, 13 )
+			&& taille_ensemble( ens3 ) == 0
+			&& somme == ( 11 + 12 ) + ( 11 + 13 ) + ( 12 + 13 )
+			, result
+		);
+
+		liberer_ensemble( ens );
+		liberer_ensemble( ens2 );
+		liberer_ensemble( ens3 );
+		liberer_ensemble( courants );
+	}
+
+	{
+		Automate * trans = materialiser_vue( vue_automate( automate, -1 ) );
+
+		TEST(
+			1
+			&& trans
+			&& est_une_transition_de_l_automate( trans, 0, 'a', 1 )
+			&& est_une_transition_de_l_automate( trans, 0, 'a', 2 )
+			&& est_une_transition_de_l_automate( trans, 1, 'b', 2 )
+			&& est_un_etat_initial_de_l_automate( trans, 0 )
+			&& est_un_etat_final_de_l_automate( trans, 2 )
+			&& taille_ensemble( get_etats( trans ) ) == 3
+			, result
+		);
+
+		liberer_automate( trans );
+	}
+
+	{
+		// Deux vues du même automate, l'une translatée pour l'éviter.
+		Vue_automate vues[2];
+		vues[0] = vue_automate( automate, 0 );
+		vues[1] = vue_translatee( automate, automate );
+
+		Automate * uni = creer_union_des_vues( vues, 2 );
+
+		TEST(
+			1
+			&& vues[1].translation == 3
+			&& taille_ensemble( get_etats( uni ) ) == 6
+			&& taille_ensemble( get_initiaux( uni ) ) == 2
+			&& est_une_transition_de_l_automate( uni, 4, 'a', 6 )
+			&& le_mot_est_reconnu( uni, "ab" )
+			&& le_mot_est_reconnu( uni, "a" )
+			&& ! le_mot_est_reconnu( uni, "b" )
+			, result
+		);
+
+		liberer_automate( uni );
+	}
+
+	{
+		// Vues qui se recouvrent : les états communs sont confondus.
+		Vue_automate vues[2];
+		vues[0] = vue_automate( automate, 0 );
+		vues[1] = vue_automate( automate, 1 );
+
+		Automate * uni = creer_union_des_vues( vues, 2 );
+
+		TEST(
+			1
+			&& taille_ensemble( get_etats( uni ) ) == 4
+			&& est_une_transition_de_l_automate( uni, 2, 'a', 3 )
+			&& est_une_transition_de_l_automate( uni, 2, 'a', 4 )
+			&& est_une_transition_de_l_automate( uni, 2, 'b', 3 )
+			, result
+		);
+
+		liberer_automate( uni );
+	}
+
+	{
+		Automate * aut = mot_to_automate( "b" );
+		Automate * mela = creer_melange_des_vues(
+			vue_automate( automate, 5 ), vue_automate( aut, -7 )
+		);
+
+		TEST(
+			1
+			&& mela
+			&& le_mot_est_reconnu( mela, "ab" )
+			&& le_mot_est_reconnu( mela, "ba" )
+			&& le_mot_est_reconnu( mela, "abb" )
+			&& le_mot_est_reconnu( mela, "bab" )
+			&& ! le_mot_est_reconnu( mela, "a" )
+			&& ! le_mot_est_reconnu( mela, "bb" )
+			, result
+		);
+
+		liberer_automate( mela );
+		liberer_automate( aut );
+	}
+
+	{
+		// Une vue seule garde son état puits implicite, translaté ; dans
+		// une union de deux automates non vides, il est matérialisé.
+		Automate * aut = mot_to_automate( "ab" );
+		Automate * complement = complementer( aut );
+		Automate * vide = creer_automate();
+		int puits = get_etat_puits( complement );
+		Automate * translate = materialiser_vue( vue_automate( complement, 10 ) );
+		const Automate * automates[2] = { vide, complement };
+		Automate * uni_seule = creer_union_de_n_automates( automates, 2, NULL );
+		Automate * uni = creer_union_des_automates( complement, aut );
+
+		int derniere[2] = { get_min_etat( translate ), -1 };
+		pour_toute_transition( translate, action_verifier_ordre, derniere );
+		int ordonnees = derniere[1] != INT_MIN;
+
+		TEST(
+			1
+			&& a_un_etat_puits( translate )
+			&& get_etat_puits( translate ) == puits + 10
+			&& a_un_etat_puits( uni_seule )
+			&& get_etat_puits( uni_seule ) == puits
+			&& ! a_un_etat_puits( uni )
+			&& ordonnees
+			&& le_mot_est_reconnu( translate, "ba" )
+			&& ! le_mot_est_reconnu( translate, "ab" )
+			&& le_mot_est_reconnu( uni_seule, "bb" )
+			&& le_mot_est_reconnu( uni, "ab" )
+			&& le_mot_est_reconnu( uni, "ba" )
+			, result
+		);
+
+		liberer_automate( uni );
+		liberer_automate( uni_seule );
+		liberer_automate( translate );
+		liberer_automate( vide );
+		liberer_automate( complement );
+		liberer_automate( aut );
+	}
+
+	liberer_automate( automate );
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_vue() ){ return 1; }
+
+	return 0;
+}